@@ -0,0 +1,170 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ ============================================================================
+ Name        : blockSizeBenchmark.cpp
+ Description : Shows the trade between latency and throughput as the block
+               size changes.  For each block size the simulator is driven
+               three ways:
+                 render      - the caller pulls samples with render()
+                 free run    - the generator runs as fast as it can
+                 real time   - the generator is paced to the sample rate and
+                               the time from a block's timestamp to its
+                               delivery is measured
+               Throughput is given in multiples of real time.
+
+               Usage: blockSizeBenchmark <config dir> [sample rate] [seconds]
+ ============================================================================
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include "RfSimulatorFactory.h"
+#include "RfSimulator.h"
+
+using namespace RfSimulators;
+
+// The rate the block size is counted at, see RfSimulator::setBlockSize
+#define BASE_SAMPLE_RATE 228000
+
+static double secondsSinceEpoch()
+{
+	return (boost::posix_time::microsec_clock::universal_time() - boost::posix_time::from_time_t(0)).total_microseconds() / 1e6;
+}
+
+/**
+ * Counts the samples delivered and the delay from each block's timestamp
+ * to its delivery.
+ */
+class BenchmarkCallback: public CallbackInterface {
+public:
+	BenchmarkCallback() {
+		reset();
+	}
+
+	void dataDelivery(std::valarray< std::complex<float> > &samples) {
+		boost::mutex::scoped_lock lock(statsMutex);
+		numSamples += samples.size();
+	}
+
+	void dataDelivery(std::valarray< std::complex<float> > &samples, const BlockMetadata &metadata) {
+		double latency = secondsSinceEpoch() - metadata.timestamp;
+
+		boost::mutex::scoped_lock lock(statsMutex);
+		numSamples += samples.size();
+		numBlocks++;
+		totalLatency += latency;
+		if (latency > maxLatency)
+			maxLatency = latency;
+	}
+
+	void reset() {
+		boost::mutex::scoped_lock lock(statsMutex);
+		numSamples = 0;
+		numBlocks = 0;
+		totalLatency = 0;
+		maxLatency = 0;
+	}
+
+	unsigned long long numSamples;
+	unsigned long long numBlocks;
+	double totalLatency;
+	double maxLatency;
+	boost::mutex statsMutex;
+};
+
+static double elapsedSeconds(const boost::posix_time::ptime &start)
+{
+	return (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "Usage: %s <config dir> [sample rate] [seconds]\n", argv[0]);
+		return 1;
+	}
+
+	std::string configDir(argv[1]);
+	unsigned int sampleRate = (argc > 2) ? atoi(argv[2]) : 2280000;
+	double seconds = (argc > 3) ? atof(argv[3]) : 3;
+
+	const unsigned int blockSizes[] = {228, 1140, 2280, 11400, 45600, FILE_INPUT_BLOCK_SIZE};
+	const size_t numBlockSizes = sizeof(blockSizes) / sizeof(blockSizes[0]);
+
+	printf("%8s %10s %12s %12s %14s %14s %14s\n", "block", "block_ms", "render_xRT", "freerun_xRT",
+			"mean_lat_ms", "max_lat_ms", "change_lat_ms");
+
+	for (size_t i = 0; i < numBlockSizes; ++i) {
+		BenchmarkCallback callback;
+		RfSimulator *simulator = RfSimulatorFactory::createFmRdsSimulator();
+
+		if (simulator->init(configDir, &callback, WARN) != 0) {
+			fprintf(stderr, "Could not initialize the simulator from %s\n", configDir.c_str());
+			delete simulator;
+			return 1;
+		}
+
+		simulator->addNoise(false);
+		simulator->setSampleRate(sampleRate);
+		simulator->setBlockSize(blockSizes[i]);
+
+		// Pull the samples directly
+		std::vector<std::complex<float> > buffer(1 << 16);
+		size_t wanted = (size_t) (seconds * sampleRate);
+		size_t rendered = 0;
+		boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+		while (rendered < wanted) {
+			rendered += simulator->render(&buffer[0], buffer.size());
+		}
+		double renderRate = (rendered / (double) sampleRate) / elapsedSeconds(start);
+
+		// Let the generator run as fast as the delivery thread takes the blocks
+		simulator->setFreeRunning(true);
+		start = boost::posix_time::microsec_clock::universal_time();
+		simulator->start();
+		boost::this_thread::sleep(boost::posix_time::microseconds((long) (seconds * 1e6)));
+		simulator->stop();
+		double freeRunRate = (callback.numSamples / (double) sampleRate) / elapsedSeconds(start);
+
+		// Pace the generator to the sample rate and time the delivery
+		callback.reset();
+		simulator->setFreeRunning(false);
+		simulator->start();
+		boost::this_thread::sleep(boost::posix_time::microseconds((long) (seconds * 1e6)));
+		simulator->stop();
+
+		double blockMs = blockSizes[i] * 1000.0 / BASE_SAMPLE_RATE;
+		double meanLatencyMs = callback.numBlocks ? 1000 * callback.totalLatency / callback.numBlocks : 0;
+
+		// A change is picked up at the next block boundary of the generator, which leads the
+		// output by up to the two ping-pong buffers, so the worst case is three blocks.
+		printf("%8u %10.2f %12.2f %12.2f %14.2f %14.2f %14.2f\n", blockSizes[i], blockMs, renderRate,
+				freeRunRate, meanLatencyMs, 1000 * callback.maxLatency, 3 * blockMs);
+
+		delete simulator;
+	}
+
+	return 0;
+}
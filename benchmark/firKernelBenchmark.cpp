@@ -0,0 +1,168 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ ============================================================================
+ Name        : firKernelBenchmark.cpp
+ Description : Times FIRFilter::run with each FirKernel the CPU supports
+               against the loop FIRFilter used before the kernels were
+               added, and checks that every kernel gives the same output
+               bit for bit.
+
+               Usage: firKernelBenchmark [repetitions]
+ ============================================================================
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include "FIRFilter.h"
+#include "FirKernel.h"
+
+/**
+ * The original FIRFilter::run, kept as the reference.  It walks the input
+ * with pointers and shortens the accumulation at both endpoints.
+ */
+static void originalRun(const ComplexArray &vIn, ComplexArray &vOut, const RealArray &coef)
+{
+	const Real *startCoef = &coef[0];
+	size_t m_length(coef.size());
+	size_t lenCoef2 = (m_length + 1) / 2;
+
+	const Complex *endIn = &vIn[vIn.size() - 1];
+	const Complex *ptrIn = &vIn[lenCoef2 - 1];
+
+	size_t lenAcc = lenCoef2;
+
+	for (size_t ii = 0; ii < vIn.size(); ++ii) {
+		const Complex *ptrData = ptrIn;
+		const Real *ptrCoef = startCoef;
+
+		Complex acc = *ptrCoef++ * *ptrData--;
+		for (size_t jj = 1; jj < lenAcc; jj++)
+			acc += *ptrCoef++ * *ptrData--;
+		vOut[ii] = acc;
+
+		if (ptrIn == endIn) {
+			lenAcc--;
+			startCoef++;
+		} else {
+			if (lenAcc < m_length)
+				lenAcc++;
+			ptrIn++;
+		}
+	}
+}
+
+static double elapsedMs(const boost::posix_time::ptime &start)
+{
+	return (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1e3;
+}
+
+static void randomFill(ComplexArray &data)
+{
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = Complex(rand() / (Real) RAND_MAX - 0.5, rand() / (Real) RAND_MAX - 0.5);
+	}
+}
+
+/**
+ * Runs one case: numTaps random taps over numSamples random samples,
+ * printing the best time of each kernel when report is set.  Returns false
+ * if any kernel differs from the original loop.
+ */
+static bool runCase(size_t numTaps, size_t numSamples, int repetitions, bool report)
+{
+	const KernelSelect::kernel_type kernels[] = {
+		KernelSelect::scalar, KernelSelect::sse2, KernelSelect::avx2, KernelSelect::avx512, KernelSelect::neon
+	};
+	const size_t numKernels = sizeof(kernels) / sizeof(kernels[0]);
+
+	ComplexArray input(numSamples);
+	ComplexArray reference(numSamples);
+	ComplexArray output(numSamples);
+	randomFill(input);
+
+	RealArray taps(numTaps);
+	for (size_t i = 0; i < numTaps; ++i) {
+		taps[i] = rand() / (Real) RAND_MAX - 0.5;
+	}
+	FIRFilter filter(input, output, &taps[0], numTaps);
+
+	if (report)
+		printf("%zu taps x %zu samples, best of %d\n", numTaps, numSamples, repetitions);
+
+	double best = 0;
+	for (int r = 0; r < repetitions; ++r) {
+		boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+		originalRun(input, reference, taps);
+		double ms = elapsedMs(start);
+		if (r == 0 || ms < best)
+			best = ms;
+	}
+	if (report)
+		printf("  %-9s %10.3f ms\n", "original", best);
+
+	bool matched = true;
+	for (size_t k = 0; k < numKernels; ++k) {
+		if (!FirKernel::select(kernels[k]))
+			continue;
+
+		for (int r = 0; r < repetitions; ++r) {
+			boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+			filter.run();
+			double ms = elapsedMs(start);
+			if (r == 0 || ms < best)
+				best = ms;
+		}
+
+		bool same = memcmp(&output[0], &reference[0], numSamples * sizeof(Complex)) == 0;
+		if (report || !same)
+			printf("  %-9s %10.3f ms%s\n", KernelSelect::name(kernels[k]), best, same ? "" : "  MISMATCH");
+		matched = matched && same;
+	}
+
+	FirKernel::select(KernelSelect::automatic);
+	return matched;
+}
+
+int main(int argc, char **argv)
+{
+	int repetitions = (argc > 1) ? atoi(argv[1]) : 5;
+	if (repetitions < 1)
+		repetitions = 1;
+
+	srand(1);
+
+	// The 30 tap filter FIRFilter designs by default, and a short filter
+	// where the overhead of each output dominates.
+	bool matched = runCase(30, 1000000, repetitions, true);
+	matched = runCase(3, 100000, repetitions, true) && matched;
+
+	// Inputs a little longer than the filter exercise the endpoint handling.
+	// The original loop reads outside inputs shorter than the filter, so
+	// those are not compared.
+	for (size_t n = 30; n <= 64; ++n) {
+		matched = runCase(30, n, 1, false) && matched;
+	}
+
+	printf("%s\n", matched ? "All kernels match the original loop" : "Kernel output differs from the original loop");
+	return matched ? 0 : 1;
+}
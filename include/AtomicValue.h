@@ -0,0 +1,106 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * AtomicValue.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIBFMRDSSIMULATOR_INCLUDE_ATOMICVALUE_H_
+#define LIBFMRDSSIMULATOR_INCLUDE_ATOMICVALUE_H_
+
+/**
+ * The ordering an atomic load or store imposes on the memory accesses around it
+ *  MEMORY_ORDER_RELAXED - none, only the access itself is atomic.
+ *  MEMORY_ORDER_ACQUIRE - later accesses are not moved before a load.
+ *  MEMORY_ORDER_RELEASE - earlier accesses are not moved after a store.
+ *  MEMORY_ORDER_SEQ_CST - all such accesses appear in one order to every thread.
+ */
+enum MemoryOrder {
+	MEMORY_ORDER_RELAXED,
+	MEMORY_ORDER_ACQUIRE,
+	MEMORY_ORDER_RELEASE,
+	MEMORY_ORDER_SEQ_CST,
+};
+
+/**
+ * A value of an integral type, 1 to 8 bytes in size, that may be loaded and stored by
+ * several threads at once.
+ *
+ * Built on the gcc __atomic builtins, available from gcc 4.7.  Older compilers, such as
+ * the gcc 4.4 of EL6, fall back to the __sync builtins, which are always full barriers,
+ * so there every access is sequentially consistent.
+ */
+template <typename T>
+class AtomicValue {
+public:
+	AtomicValue() : value(T()) {}
+	explicit AtomicValue(T initial) : value(initial) {}
+
+	T load(MemoryOrder order = MEMORY_ORDER_SEQ_CST) const {
+#ifdef __ATOMIC_SEQ_CST
+		switch (order) {
+		case MEMORY_ORDER_RELAXED:
+			return __atomic_load_n(&value, __ATOMIC_RELAXED);
+		case MEMORY_ORDER_ACQUIRE:
+			return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+		default:
+			return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+		}
+#else
+		(void) order;
+		// A compare and swap that never changes the value reads it atomically at any size
+		return __sync_val_compare_and_swap(const_cast<T *>(&value), T(), T());
+#endif
+	}
+
+	void store(T newValue, MemoryOrder order = MEMORY_ORDER_SEQ_CST) {
+#ifdef __ATOMIC_SEQ_CST
+		switch (order) {
+		case MEMORY_ORDER_RELAXED:
+			__atomic_store_n(&value, newValue, __ATOMIC_RELAXED);
+			break;
+		case MEMORY_ORDER_RELEASE:
+			__atomic_store_n(&value, newValue, __ATOMIC_RELEASE);
+			break;
+		default:
+			__atomic_store_n(&value, newValue, __ATOMIC_SEQ_CST);
+			break;
+		}
+#else
+		(void) order;
+		T expected = value;
+		T previous;
+		while ((previous = __sync_val_compare_and_swap(&value, expected, newValue)) != expected) {
+			expected = previous;
+		}
+#endif
+	}
+
+private:
+	// Not copyable, as a copy could not be made atomically
+	AtomicValue(const AtomicValue &);
+	AtomicValue &operator=(const AtomicValue &);
+
+	// Aligned to its size so that 8 byte values are also atomic on 32 bit x86
+	T value __attribute__((aligned(sizeof(T))));
+};
+
+#endif /* LIBFMRDSSIMULATOR_INCLUDE_ATOMICVALUE_H_ */
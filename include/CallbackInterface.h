@@ -29,16 +29,53 @@
 #include <valarray>
 #include <complex>
 
+// Default block size, see RfSimulator::setBlockSize
 #define FILE_INPUT_BLOCK_SIZE 100000
 #define OUTPUT_SAMPLES_BLOCK_SIZE FILE_INPUT_BLOCK_SIZE*10
 
 
 namespace RfSimulators {
 
+/**
+ * What changed between the previous block delivered and this one
+ */
+enum BlockFlags {
+	SAMPLES_DROPPED = 1,		// Samples were dropped by the queue's overflow policy
+	RETUNED = 2,				// The center frequency changed
+	SAMPLE_RATE_CHANGED = 4,	// The sample rate changed
+	GAIN_CHANGED = 8,			// The gain changed
+	COALESCED = 16,				// The block is several blocks appended by the COALESCE overflow policy
+};
+
+/**
+ * Describes a delivered block of samples
+ */
+struct BlockMetadata {
+	unsigned long long sampleIndex;	// Index of the first sample, counted at the output sample rate since start
+	double timestamp;				// UTC seconds since the epoch at which generation of the block began
+	float centerFrequency;			// Hz
+	unsigned int sampleRate;		// Samples per second
+	float gain;						// dB
+	unsigned int flags;				// BlockFlags for the changes since the previous block
+};
+
 class CallbackInterface
 {
 public:
+    /**
+     * Called from the delivery thread with each block of samples.  The samples belong to
+     * a buffer that is reused once this returns, so copy any that must be kept.
+     */
     virtual void dataDelivery(std::valarray< std::complex<float> > &samples) = 0;
+
+    /**
+     * Called from the delivery thread with each block of samples and a description of it.
+     * Override this to receive the metadata, the default passes the samples alone to the
+     * method above.  The same buffer rules apply.
+     */
+    virtual void dataDelivery(std::valarray< std::complex<float> > &samples, const BlockMetadata & /*metadata*/) {
+        dataDelivery(samples);
+    }
 };
 
 };
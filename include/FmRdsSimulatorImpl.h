@@ -27,11 +27,15 @@
 #include <boost/asio.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <queue>
+#include <map>
 #include <complex>
 #include "RfSimulator.h"
 #include "Transmitter.h"
 #include "UserDataQueue.h"
-#include "FIRFilter.h"
+#include "RingDataQueue.h"
+#include "WorkerPool.h"
+#include "MultistageDecimator.h"
+#include "GaussianNoise.h"
 
 #include "CallbackInterface.h"
 
@@ -64,6 +68,53 @@ public:
 	 */
 	void setQueueSize(unsigned short queueSize);
 
+	/**
+	 * Chooses the queue between the generator and the thread that calls the user's callback.
+	 * LOCK_FREE_RING avoids taking a lock per block, which matters most for small blocks.
+	 * Takes effect the next time start is called.
+	 */
+	void setQueueType(QueueType type);
+	QueueType getQueueType();
+
+	/**
+	 * Set how long either side of a LOCK_FREE_RING spins waiting for the other before it
+	 * sleeps.  Longer spins lower the latency of delivery at the cost of a busy core.  A
+	 * value of 0 sleeps straight away.  Takes effect the next time start is called.
+	 */
+	void setQueueSpinTime(unsigned int microseconds);
+	unsigned int getQueueSpinTime();
+
+	/**
+	 * Returns the counters and latency histograms of the data queue, or zeros if the
+	 * simulator is not running.
+	 */
+	QueueStatistics getQueueStatistics();
+
+	/**
+	 * Chooses what the data queue does when the user falls more than the queue size behind.
+	 * DROP_OLDEST by default.  Free running always uses BLOCK_PRODUCER.
+	 */
+	void setOverflowPolicy(OverflowPolicy policy);
+	OverflowPolicy getOverflowPolicy();
+
+	/**
+	 * Returns the most recent runs of samples dropped by the overflow policy, in sample order,
+	 * or an empty vector if the simulator is not running.
+	 */
+	std::vector<QueueGap> getQueueGaps();
+
+	/**
+	 * Set the number of threads used to generate the transmitter data.  A value of
+	 * 0 will use one thread per core.  Takes effect the next time start is called.
+	 */
+	void setNumWorkerThreads(unsigned int numThreads);
+	unsigned int getNumWorkerThreads();
+
+	/**
+	 * Returns the counters for each of the worker threads, or an empty
+	 * vector if the simulator is not running.
+	 */
+	std::vector<WorkerStatistics> getWorkerStatistics();
 
 	void setCenterFrequency(float freq) throw(OutOfRangeException);
 	void setCenterFrequencyRange(float minGain, float maxGain);
@@ -76,36 +127,119 @@ public:
 
 	void stop();
 
+	/**
+	 * When free running, blocks are generated as fast as the CPU allows rather than being paced
+	 * to real time, and the generator waits for the user to consume data rather than dropping it.
+	 * The RDS clock time follows the number of samples generated instead of the wall clock.
+	 * Takes effect the next time start is called.
+	 */
+	void setFreeRunning(bool freeRunning);
+	bool isFreeRunning();
+
+	/**
+	 * Chooses how the visible stations are combined.  FFT_SYNTHESIS costs about the same as a few
+	 * stations whatever their number, so is the faster choice once many stations are in band.
+	 * Takes effect the next time start or render is called.
+	 */
+	void setCombiner(Combiner combiner);
+	Combiner getCombiner();
+
+	/**
+	 * Set the number of samples generated per block at the 228 kHz base sample rate.  Each
+	 * callback delivers one block, so this sets both the callback interval and the latency
+	 * of retunes, gain and sample rate changes.  Smaller blocks lower the latency at the
+	 * cost of throughput.  Takes effect the next time start or render is called.
+	 */
+	void setBlockSize(unsigned int numSamples) throw(InvalidValue);
+	unsigned int getBlockSize();
+
+	/**
+	 * Generates numSamples samples at the current sample rate directly into out on the calling
+	 * thread.  No callbacks are made and the simulator must not be started.  Successive calls
+	 * continue the same stream.  The RDS clock time follows the number of samples generated.
+	 * Returns the number of samples written.
+	 */
+	size_t render(std::complex<float> *out, size_t numSamples);
+
 	void addNoise(bool shouldAddNoise);
 	void setNoiseSigma(float sigma);
 	float getNoiseSigma();
 
+	/**
+	 * Sets the seed of the noise generator and restarts its stream.  The noise is a function
+	 * of the seed and the sample index alone, so the same seed reproduces the same noise.
+	 */
+	void setNoiseSeed(unsigned int seed);
+	unsigned int getNoiseSeed();
+
 private:
 	int loadCfgFile(path filPath);
 	CallbackInterface *userClass;
 	unsigned int maxQueueSize;
+	QueueType queueType;
+	unsigned int queueSpinTime;
+	OverflowPolicy overflowPolicy;
+	// Samples handed to the data queue since start, only touched by the delivering thread
+	unsigned long long deliveredSamples;
 
 	void dataGrab(const boost::system::error_code& error, boost::asio::deadline_timer* alarm);
-	void fillNoiseArray();
+	bool deliverBlock();
+	size_t outputBlockSize();
+	void createDecimator();
+	void decimateBlock(unsigned int index, std::complex<float> *out, float blockGain);
+	void runJob(const WorkerPool::Job &job);
+	void waitForJobs();
+	void generatorLoop();
+	float generateBlock(std::valarray<std::complex<float> > &preFiltArray);
+	void mixTransmitters(std::valarray<std::complex<float> > *preFiltArray, size_t first, size_t count);
+	void synthesizeTransmitters(std::valarray<std::complex<float> > &preFiltArray);
+	void applyCombiner();
+	void applyBlockSize();
 
 	boost::asio::io_service io;
 	boost::asio::deadline_timer * alarm;
 	void _start();
 	boost::thread *io_service_thread;
-	bool stopped, initialized, shouldAddNoise;
+	bool stopped, initialized, shouldAddNoise, freeRunning, rendering;
 	float tunedFreq;
 	float gain;
 	unsigned int sampleRate;
-	std::valarray<std::complex<float> > awgnNoise;
-	std::valarray<std::complex<float> > postFiltArray, preFiltArray;
+	unsigned int blockSize;
+	boost::posix_time::time_duration callbackInterval;
+	// Ping-pong buffers, one is generated into while the other is filtered and delivered
+	std::valarray<std::complex<float> > preFiltArrays[2];
+	bool blockReady[2];
+	// The center frequency each of the ping-pong buffers was generated at
+	float blockTunedFreqs[2];
+	// UTC seconds since the epoch at which generation of each of the ping-pong buffers began
+	double blockTimestamps[2];
+	unsigned int outputIndex;
+	bool pipelineRunning;
+	boost::thread *generatorThread;
+	boost::mutex pipelineMutex;
+	boost::condition_variable pipelineCond;
+
+	// Holds the remainder of a rendered block that did not fit in the user's buffer
+	std::valarray<std::complex<float> > renderBuffer;
+	size_t renderBufferPos;
 	float maxFreq, minFreq, minGain, maxGain, noiseSigma;
 	std::vector<Transmitter*> transmitters;
+	// The transmitters keyed by their center frequency
+	std::multimap<float, Transmitter*> transmitterIndex;
+	// The transmitters visible in the block being generated, only touched by the generating thread
+	std::vector<Transmitter*> activeTransmitters;
 	UserDataQueue *userDataQueue;
-	FIRFilter *filter;
+	WorkerPool *workerPool;
+	unsigned int numWorkerThreads;
+	MultistageDecimator *decimator;
+	Combiner combiner;
+	// Fresh noise for every block, guarded by the noiseMutex
+	GaussianNoise *noise;
+	// Combines the stations when the combiner is FFT_SYNTHESIS, otherwise NULL
+	FftSynthesizer *synthesizer;
 	std::vector<unsigned int> availableSampleRates;
-	int pi; // The puncture index;
 
-	boost::mutex sampleRateMutex, noiseArrayMutex;
+	boost::mutex sampleRateMutex, noiseMutex, tunedFreqMutex;
 
 };
 } // End of namespace
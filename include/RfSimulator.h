@@ -28,7 +28,9 @@
 
 #include "CallbackInterface.h"
 #include <string.h>
+#include <vector>
 #include "Exceptions.h"
+#include "SimulatorStatistics.h"
 
 namespace RfSimulators {
 
@@ -41,6 +43,46 @@ enum LogLevel {
 	FATAL,
 };
 
+/**
+ * How the visible stations are combined into the wideband output.
+ *  TUNE_AND_SUM - each station is upsampled and shifted on its own then summed.  The cost grows with the number of stations.
+ *  FFT_SYNTHESIS - the stations are placed into the bins of a shared spectrum and combined with one inverse FFT per frame.
+ */
+enum Combiner {
+	TUNE_AND_SUM,
+	FFT_SYNTHESIS,
+};
+
+/**
+ * The queue that carries blocks from the generator to the thread that calls the user's callback.
+ *  LOCKING_QUEUE - a queue guarded by a mutex, the delivery thread sleeps on a condition variable.
+ *  LOCK_FREE_RING - a single producer, single consumer ring that takes no locks while either side has
+ *                   work.  A side that has to wait spins for the queue spin time before it sleeps.
+ */
+enum QueueType {
+	LOCKING_QUEUE,
+	LOCK_FREE_RING,
+};
+
+/**
+ * What the data queue does with a new block when it already holds the queue size in blocks.
+ *  BLOCK_PRODUCER - the generator waits for the user to take a block.  Always used when free running.
+ *  DROP_OLDEST - the oldest queued block is dropped to make room.
+ *  DROP_NEWEST - the new block is dropped.
+ *  COALESCE - the new block is appended to the newest queued block so no samples are lost, until
+ *             that block holds the queue size in blocks, after which the oldest block is dropped.
+ *             Each append copies into a larger buffer, so this policy allocates memory while
+ *             the queue overflows.
+ *  FLUSH_QUEUE - every queued block is dropped along with the new one.
+ */
+enum OverflowPolicy {
+	BLOCK_PRODUCER,
+	DROP_OLDEST,
+	DROP_NEWEST,
+	COALESCE,
+	FLUSH_QUEUE,
+};
+
 
 class RfSimulator
 {
@@ -57,6 +99,18 @@ public:
 	virtual float getGain() = 0;
 
 	virtual void setQueueSize(unsigned short queueSize) = 0;
+	virtual void setQueueType(QueueType type) = 0;
+	virtual QueueType getQueueType() = 0;
+	virtual void setQueueSpinTime(unsigned int microseconds) = 0;
+	virtual unsigned int getQueueSpinTime() = 0;
+	virtual QueueStatistics getQueueStatistics() = 0;
+	virtual void setOverflowPolicy(OverflowPolicy policy) = 0;
+	virtual OverflowPolicy getOverflowPolicy() = 0;
+	virtual std::vector<QueueGap> getQueueGaps() = 0;
+
+	virtual void setNumWorkerThreads(unsigned int numThreads) = 0;
+	virtual unsigned int getNumWorkerThreads() = 0;
+	virtual std::vector<WorkerStatistics> getWorkerStatistics() = 0;
 
 	virtual void setCenterFrequency(float freq) throw(OutOfRangeException) = 0;
 	virtual float getCenterFrequency() = 0;
@@ -67,6 +121,19 @@ public:
 	virtual void addNoise(bool addNoise) = 0;
 	virtual void setNoiseSigma(float sigma) = 0;
 	virtual float getNoiseSigma() = 0;
+	virtual void setNoiseSeed(unsigned int seed) = 0;
+	virtual unsigned int getNoiseSeed() = 0;
+
+	virtual void setBlockSize(unsigned int numSamples) throw(InvalidValue) = 0;
+	virtual unsigned int getBlockSize() = 0;
+
+	virtual void setFreeRunning(bool freeRunning) = 0;
+	virtual bool isFreeRunning() = 0;
+
+	virtual void setCombiner(Combiner combiner) = 0;
+	virtual Combiner getCombiner() = 0;
+
+	virtual size_t render(std::complex<float> *out, size_t numSamples) = 0;
 
 	virtual void start() = 0;
 	virtual void stop() = 0;
@@ -0,0 +1,101 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * RingDataQueue.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIBFMRDSSIMULATOR_INCLUDE_RINGDATAQUEUE_H_
+#define LIBFMRDSSIMULATOR_INCLUDE_RINGDATAQUEUE_H_
+
+#include <vector>
+#include "UserDataQueue.h"
+
+// Keeps the indices written by the generator and by the delivery thread on separate cache lines
+#define CACHE_LINE_SIZE 64
+
+/**
+ * A user data queue on a bounded single producer, single consumer ring.
+ *
+ * The generator writes blocks at writeIndex and the delivery thread takes them from
+ * readIndex.  Each index is only written by one side, so neither takes a lock while
+ * there is work to do.  A side that has to wait spins for up to the spin time and then
+ * parks on a condition variable.  The other side only takes the park mutex, to wake it,
+ * when it sees that it has parked.
+ *
+ * The producer cannot remove blocks from the ring, so to drop queued blocks it marks them
+ * as flushed and the delivery thread discards them, and records the gaps, instead of
+ * passing them to the user.  Flushed blocks keep their slots until then, so the ring has
+ * room for 2 * maxQueueDepth + 1 blocks.  It can not grow, so a larger depth takes effect
+ * the next time the queue is created.  When coalescing, the producer holds back the newest
+ * block while the queue is full so that later blocks can be appended to it, and queues it
+ * at the next delivery that finds room.
+ */
+class RingDataQueue : public UserDataQueue {
+public:
+	RingDataQueue(unsigned short maxQueueDepth, CallbackInterface *userClass, unsigned int spinMicroseconds);
+	virtual ~RingDataQueue();
+
+	void deliverData(const SampleBufferPool::Buffer &buffer, const RfSimulators::BlockMetadata &metadata);
+	void shutDown();
+	void setMaxQueueSize(unsigned short size);
+	void setOverflowPolicy(RfSimulators::OverflowPolicy policy);
+
+protected:
+	void _waitForData();
+	size_t maxBlocksHeld();
+
+private:
+	bool waitForBlock(unsigned long long read);
+	void waitForSpace(unsigned long long write);
+	bool hasRoom(unsigned long long write, unsigned int depth);
+	void dropOldest(unsigned long long write);
+	void publish(const QueuedBlock &block, unsigned long long &write);
+	void wakeConsumer();
+	void wakeProducer();
+
+	std::vector<QueuedBlock> slots;
+	unsigned long long spinNanoseconds;
+	AtomicValue<bool> shuttingDown;
+	AtomicValue<RfSimulators::OverflowPolicy> policy;
+	AtomicValue<unsigned int> depth;
+
+	// The newest block, held back by the producer while coalescing
+	QueuedBlock pending;
+
+	// Blocks before this index are discarded by the delivery thread, written by the producer
+	AtomicValue<unsigned long long> flushIndex;
+
+	char pad0[CACHE_LINE_SIZE];
+	AtomicValue<unsigned long long> writeIndex;
+	char pad1[CACHE_LINE_SIZE];
+	AtomicValue<unsigned long long> readIndex;
+	char pad2[CACHE_LINE_SIZE];
+
+	// Only used to park a side that has run out of work
+	boost::mutex parkMutex;
+	boost::condition_variable dataAvailable;
+	boost::condition_variable spaceAvailable;
+	AtomicValue<bool> consumerParked;
+	AtomicValue<bool> producerParked;
+};
+
+#endif /* LIBFMRDSSIMULATOR_INCLUDE_RINGDATAQUEUE_H_ */
@@ -0,0 +1,70 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * SampleBufferPool.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIBFMRDSSIMULATOR_INCLUDE_SAMPLEBUFFERPOOL_H_
+#define LIBFMRDSSIMULATOR_INCLUDE_SAMPLEBUFFERPOOL_H_
+
+#include <boost/shared_ptr.hpp>
+#include <valarray>
+#include <complex>
+#include <vector>
+
+/**
+ * A set of preallocated, reference counted sample buffers.
+ *
+ * The pool keeps a reference to every buffer it has created and a buffer is free again
+ * once the pool holds the only reference, so a block handed through the user data queue
+ * is recycled as soon as the last copy of its pointer is dropped, whether after the
+ * user's callback returns or when the queue discards it.  Once the pool has a free buffer
+ * of the requested size, acquiring one neither allocates nor copies.
+ *
+ * Only one thread may acquire buffers.  Any thread may release them.
+ */
+class SampleBufferPool {
+public:
+	typedef std::valarray< std::complex<float> > Samples;
+	typedef boost::shared_ptr<Samples> Buffer;
+
+	SampleBufferPool();
+	virtual ~SampleBufferPool();
+
+	/**
+	 * Returns a free buffer of size samples, resizing a free buffer of another size or
+	 * adding one to the pool if none is available.
+	 */
+	Buffer acquire(size_t size);
+
+	/**
+	 * Allocates buffers of size samples until the pool holds numBuffers of them.
+	 */
+	void reserve(size_t numBuffers, size_t size);
+
+	size_t numBuffers();
+
+private:
+	std::vector<Buffer> buffers;
+};
+
+#endif /* LIBFMRDSSIMULATOR_INCLUDE_SAMPLEBUFFERPOOL_H_ */
@@ -36,10 +36,16 @@ using namespace std;
 #define MAX_OUTPUT_SAMPLE_RATE (BASE_SAMPLE_RATE*10.0)
 #define MIN_OUTPUT_SAMPLE_RATE (MAX_OUTPUT_SAMPLE_RATE / 1000)
 
+#define MIN_INPUT_BLOCK_SIZE 228 // 1 ms at the base sample rate
+
 #define MAX_FREQUENCY_DEVIATION 75000.0
 
 #define FILTER_ATTENUATION 70 // dB
 
+#define DEFAULT_NOISE_SEED 0
+
+#define OUTPUT_PASSBAND 0.4 // Edge of the flat part of the output band, as a fraction of the output sample rate
+
 static string DEFAULT_RDS_CALL_SIGN = "WSDR";
 static string DEFAULT_RDS_SHORT_TEXT = "REDHAWK!";
 static string DEFAULT_RDS_FULL_TEXT = "REDHAWK Radio, Rock the Hawk! (www.redhawksdr.org)";
@@ -0,0 +1,73 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * SimulatorStatistics.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIBFMRDSSIMULATOR_INCLUDE_SIMULATORSTATISTICS_H_
+#define LIBFMRDSSIMULATOR_INCLUDE_SIMULATORSTATISTICS_H_
+
+namespace RfSimulators {
+
+/**
+ * Counters for a single thread of the transmitter worker pool.  The counters are
+ * accumulated from the time the simulator was started.
+ */
+struct WorkerStatistics {
+	unsigned long long jobsExecuted;	// Total jobs run by this worker
+	unsigned long long jobsStolen;		// Jobs this worker took from another worker's queue
+	unsigned long long jobsFailed;		// Jobs, of those executed, that ended by throwing an exception
+	double busySeconds;					// Time spent running jobs
+	double elapsedSeconds;				// Time since the worker was started
+	double utilization;					// busySeconds / elapsedSeconds
+};
+
+// Bucket i of a queue latency histogram counts latencies of [2^i, 2^(i+1)) ns.  The first
+// bucket also holds latencies under 1 ns and the last everything of 2^31 ns or more.
+#define QUEUE_LATENCY_BUCKETS 32
+
+/**
+ * Counters for the queue between the block generator and the thread that calls the user's
+ * callback.  The counters are accumulated from the time the simulator was started.
+ */
+struct QueueStatistics {
+	unsigned long long blocksDelivered;		// Blocks passed to the user's callback
+	unsigned long long consumerWaits;		// Times the delivery thread slept waiting for a block
+	unsigned long long droppedBlocks;		// Blocks discarded by the overflow policy
+	unsigned long long droppedSamples;		// Samples in the dropped blocks
+	unsigned long long coalescedBlocks;		// Blocks appended to the one queued before them
+	unsigned long long enqueueLatency[QUEUE_LATENCY_BUCKETS];	// Time taken to hand a block to the queue
+	unsigned long long dequeueLatency[QUEUE_LATENCY_BUCKETS];	// Time from a block entering the queue to the delivery thread taking it
+};
+
+/**
+ * A run of samples that was dropped from the stream.  Samples are numbered at the output
+ * sample rate from the time the simulator was started.
+ */
+struct QueueGap {
+	unsigned long long sampleIndex;			// Index of the first sample dropped
+	unsigned long long numSamples;			// Number of consecutive samples dropped
+};
+
+};
+
+#endif /* LIBFMRDSSIMULATOR_INCLUDE_SIMULATORSTATISTICS_H_ */
@@ -34,6 +34,8 @@
 #include <complex>
 #include "Tuner.h"
 #include "FIRFilter.h"
+#include "PolyphaseInterpolator.h"
+#include "FftSynthesizer.h"
 #include "FirFilterDesigner.h"
 #include "fftw3.h"
 #include "fftw_allocator.h"
@@ -47,8 +49,13 @@ extern "C" {
 using namespace boost::filesystem;
 using namespace boost;
 
+#define INTERPOLATION_FACTOR 10 // MAX_OUTPUT_SAMPLE_RATE / BASE_SAMPLE_RATE
+
 #define FILTER_CUTOFF (0.5*0.5*(BASE_SAMPLE_RATE / MAX_OUTPUT_SAMPLE_RATE)) // normalized frequency
 
+// The modulated signal is generated at the base sample rate so occupies at most this either side of the center frequency
+#define TRANSMITTER_HALF_BANDWIDTH (0.5*BASE_SAMPLE_RATE)
+
 class Transmitter {
 public:
 	Transmitter();
@@ -59,12 +66,22 @@ public:
 	void setRdsShortText(std::string shortText);
 	void setRdsCallSign(std::string callSign);
 	void setProgramType(uint16_t pty);
+	void setSimulatedClock(bool useSimulatedClock);
 	virtual ~Transmitter();
-	std::valarray< std::complex<float> >& getData();
 	friend std::ostream& operator<<(std::ostream &strm, const Transmitter &tx);
-	void start();
-	void join();
 	int init(float centerFreq, int numSamples);
+	void setBlockSize(int numSamples);
+	bool beginBlock(float blockTunedFrequency, float halfBandwidth);
+	void deactivate();
+	void releaseBuffers();
+	int generate();
+	void mix(size_t first, size_t count, std::complex<float> *out);
+	void finishBlock();
+	bool isActive();
+	size_t getBlockSize();
+	void setSynthesized(bool synthesized);
+	static RealArray getInterpolationFilter();
+	FftSynthesizer::Channel* getChannel();
 
 private:
 
@@ -80,28 +97,31 @@ private:
 	std::string rdsShortText;
 	std::string rdsCallSign;
 
-	thread m_Thread;
 	int numSamples;
-	int doWork();
 	unsigned int callSignToInt(std::string callSign);
+	void allocateBuffers();
 
 	std::valarray<float> mpx_buffer;
 	std::valarray< std::complex<float> > basebandCmplx;
-	std::valarray< std::complex<float> > basebandCmplx_polyPhaseout;
 	std::valarray< std::complex<float> > basebandCmplxUpSampled;
-	std::valarray< std::complex<float> > basebandCmplxUpSampledTuned;
-	std::vector<FIRFilter *> polyphaseFilters;
-	std::vector< std::vector<float> > polyphaseFilterTaps;
+	PolyphaseInterpolator *interpolator;
 
 
 	rds_content_struct rds_content;
 	rds_signal_info rds_sig_info;
 	fm_mpx_struct fm_mpx_status_struct;
 	bool initialized;
+	bool active;
+	bool buffersAllocated;
+	// When synthesized the station stops at the base sample rate and is interpolated, shifted and summed by an FftSynthesizer
+	bool synthesized;
+	FftSynthesizer::Channel channel;
 	FrequencyModulator fm;
 
 	Tuner tuner;
 	boost::mutex tunerMutex;
+	bool retunePending;
+	float pendingNormFc;
 
 };
 
@@ -32,32 +32,113 @@
 #include <valarray>
 #include <complex>
 #include <queue>
+#include <deque>
+#include <vector>
+#include "AtomicValue.h"
 #include "CallbackInterface.h"
+#include "RfSimulator.h"
+#include "SampleBufferPool.h"
+#include "SimulatorStatistics.h"
 
 using namespace RfSimulators;
 
+/**
+ * Carries blocks from the generator to a thread that passes them to the user's callback.
+ * Only one thread may deliver data.  The queue is guarded by a mutex, see RingDataQueue
+ * for a lock free alternative.
+ */
 class UserDataQueue {
 public:
 	UserDataQueue(unsigned short maxQueueDepth, CallbackInterface *userClass);
 	virtual ~UserDataQueue();
 
-	void deliverData(std::valarray< std::complex<float> > &dataArray);
+	/**
+	 * Returns a free buffer of size samples from the pool.  Fill it and pass it to
+	 * deliverData; it is recycled once the user's callback returns.  Only the thread
+	 * that delivers data may call this.
+	 */
+	SampleBufferPool::Buffer getBuffer(size_t size);
+
+	/**
+	 * Preallocates enough buffers of size samples to fill the queue.
+	 */
+	void reserveBuffers(size_t size);
+
+	/**
+	 * Queues a block described by metadata.  When the queue already holds the maximum
+	 * queue depth in blocks the overflow policy is applied.  The flags of the metadata are
+	 * filled in as the block is passed to the user.
+	 */
+	virtual void deliverData(const SampleBufferPool::Buffer &buffer, const RfSimulators::BlockMetadata &metadata);
 	void waitForData();
-	void shutDown();
-	void setMaxQueueSize(unsigned short size);
+	virtual void shutDown();
+	virtual void setMaxQueueSize(unsigned short size);
+	virtual void setOverflowPolicy(RfSimulators::OverflowPolicy policy);
+
+	RfSimulators::QueueStatistics getStatistics();
+
+	/**
+	 * Returns the most recent gaps in the stream left by dropped blocks, in sample order.
+	 */
+	std::vector<RfSimulators::QueueGap> getGaps();
+
+protected:
+	/**
+	 * A block waiting in the queue
+	 */
+	struct QueuedBlock {
+		SampleBufferPool::Buffer buffer;
+		RfSimulators::BlockMetadata metadata;
+		unsigned long long enqueueTime;		// now() when the block was handed to the queue
+	};
+
+	virtual void _waitForData();
+
+	/**
+	 * The most blocks the queue itself can hold at once, not counting the block with the
+	 * user or the one being filled.
+	 */
+	virtual size_t maxBlocksHeld();
+	void joinThread();
+	void deliverToUser(QueuedBlock &block);
+	void recordGap(const QueuedBlock &block);
+	void coalesce(QueuedBlock &block, const QueuedBlock &next);
+	static bool canCoalesce(const QueuedBlock &block, const QueuedBlock &next, unsigned int depth);
+
+	static unsigned long long now();
+	static void increment(AtomicValue<unsigned long long> &counter);
+	static void recordLatency(AtomicValue<unsigned long long> *histogram, unsigned long long nanoseconds);
+
+	// Each counter has a single writer so may be incremented without a read-modify-write
+	AtomicValue<unsigned long long> blocksDelivered;
+	AtomicValue<unsigned long long> consumerWaits;
+	AtomicValue<unsigned long long> enqueueLatency[QUEUE_LATENCY_BUCKETS];
+	AtomicValue<unsigned long long> dequeueLatency[QUEUE_LATENCY_BUCKETS];
+	CallbackInterface *userClass;
 
 private:
-	void process_data();
+	// The last block passed to the user, only touched by the delivery thread
+	bool hasDelivered;
+	RfSimulators::BlockMetadata lastDelivered;
+	unsigned long long nextSample;
 
 	bool shuttingDown;
+	RfSimulators::OverflowPolicy policy;
 
 	boost::condition_variable cond;
+	boost::condition_variable spaceAvailable;
 	boost::mutex mut;
 	unsigned short maxQueueDepth;
-	std::queue< std::valarray< std::complex<float> > > internalDataBuffer;
-	CallbackInterface *userClass;
-	void _waitForData();
+	std::queue<QueuedBlock> internalDataBuffer;
+	SampleBufferPool *bufferPool;
 	boost::thread *waitForDataThread;
+
+	// Dropped blocks may be recorded by either thread
+	boost::mutex gapMutex;
+	std::deque<RfSimulators::QueueGap> gaps;
+	unsigned long long droppedBlocks;
+	unsigned long long droppedSamples;
+	unsigned long long coalescedBlocks;
 };
 
 #endif /* LIBFMRDSSIMULATOR_INCLUDE_USERDATAQUEUE_H_ */
@@ -0,0 +1,97 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * WorkerPool.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef LIBFMRDSSIMULATOR_INCLUDE_WORKERPOOL_H_
+#define LIBFMRDSSIMULATOR_INCLUDE_WORKERPOOL_H_
+
+#include <boost/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/function.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <deque>
+#include <vector>
+#include "SimulatorStatistics.h"
+
+/**
+ * A fixed set of long lived threads that service posted jobs.
+ *
+ * The simulator used to spawn and join a thread per transmitter for every block which
+ * becomes expensive with many stations.  Instead, jobs are posted to the pool and
+ * wait() acts as a latch, returning once every posted job has completed.
+ *
+ * Each worker owns a deque of jobs.  Jobs posted from outside the pool are dealt out
+ * round robin, jobs posted from within a running job are pushed onto the calling
+ * worker's own deque.  Workers take from the back of their own deque and, when it is
+ * empty, steal from the front of another worker's deque so a few expensive stations
+ * do not leave the remaining cores idle.
+ *
+ * A job that throws is logged and counted as failed.  It still counts as complete so
+ * wait() does not block on it.
+ */
+class WorkerPool {
+public:
+	typedef boost::function<void ()> Job;
+
+	/**
+	 * Creates the pool.  A numThreads of 0 will size the pool to the number of cores.
+	 */
+	WorkerPool(unsigned int numThreads = 0);
+	virtual ~WorkerPool();
+
+	void post(const Job &job);
+	void wait();
+	unsigned int size();
+	std::vector<RfSimulators::WorkerStatistics> getStatistics();
+
+private:
+	struct Worker {
+		boost::mutex mut;
+		std::deque<Job> jobs;
+		unsigned long long jobsExecuted;
+		unsigned long long jobsStolen;
+		unsigned long long jobsFailed;
+		boost::posix_time::time_duration busyTime;
+	};
+
+	void workerLoop(unsigned int index);
+	bool takeJob(unsigned int index, Job &job);
+
+	bool shuttingDown;
+	unsigned int outstandingJobs;
+	int queuedJobs;
+	unsigned int nextWorker;
+
+	boost::mutex mut;
+	boost::condition_variable jobReady;
+	boost::condition_variable jobsComplete;
+	std::vector<Worker *> workers;
+	boost::thread_group threads;
+	boost::thread_specific_ptr<unsigned int> workerIndex;
+	boost::posix_time::ptime startTime;
+};
+
+#endif /* LIBFMRDSSIMULATOR_INCLUDE_WORKERPOOL_H_ */
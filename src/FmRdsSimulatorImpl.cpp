@@ -29,21 +29,28 @@ using namespace std;
 #include "SimDefaults.h"
 #include "tinyxml.h"
 
-#include <boost/random.hpp>
-#include <boost/random/normal_distribution.hpp>
 #include <float.h>
 
 
 namespace RfSimulators {
-// Call back interval is 1000ms / (samplerate / samples per block)
-#define CALLBACK_INTERVAL (1000.0/(BASE_SAMPLE_RATE/FILE_INPUT_BLOCK_SIZE))// TODO: Make this configurable.
-
 #define INITIAL_CENTER_FREQ 88500000
 #define DEFAULT_QUEUE_SIZE 5
+#define DEFAULT_QUEUE_SPIN_TIME 50 // microseconds
+
+// Number of samples in each of the mixing jobs handed to the worker pool.
+#define MIX_CHUNK_SIZE 131072
+
+// Size of the FFT of each frame of a station when combining by FFT synthesis.  The shared inverse FFT is
+// INTERPOLATION_FACTOR times this, with bins 2.28 MHz / 10240 = 223 Hz apart.
+#define SYNTHESIS_FFT_SIZE 1024
 
 
 FmRdsSimulatorImpl::FmRdsSimulatorImpl() {
 	maxQueueSize = DEFAULT_QUEUE_SIZE;
+	queueType = LOCKING_QUEUE;
+	queueSpinTime = DEFAULT_QUEUE_SPIN_TIME;
+	overflowPolicy = DROP_OLDEST;
+	deliveredSamples = 0;
 	stopped = true;
 	initialized = false;
 	shouldAddNoise = true;
@@ -56,7 +63,14 @@ FmRdsSimulatorImpl::FmRdsSimulatorImpl() {
 	alarm = NULL;
 	userClass = NULL;
 	userDataQueue = NULL;
-	filter = NULL;
+	workerPool = NULL;
+	generatorThread = NULL;
+	numWorkerThreads = 0;
+	freeRunning = false;
+	rendering = false;
+	renderBufferPos = 0;
+	pipelineRunning = false;
+	outputIndex = 0;
 
 	tunedFreq = INITIAL_CENTER_FREQ;
 	gain = 0.0;
@@ -64,20 +78,23 @@ FmRdsSimulatorImpl::FmRdsSimulatorImpl() {
 	maxGain = 100;
 	sampleRate = MAX_OUTPUT_SAMPLE_RATE;
 	noiseSigma = 0.1;
-	pi = 0;
-
-
-	// Initialize our noise vector.  We always use the same noise vector to keep the processing down.
-	awgnNoise.resize(MAX_OUTPUT_SAMPLE_RATE);
-
-	fillNoiseArray();
-
-	preFiltArray.resize(OUTPUT_SAMPLES_BLOCK_SIZE, complex<float> (0.0, 0.0));
+	noise = new GaussianNoise(DEFAULT_NOISE_SEED, noiseSigma);
+	blockSize = FILE_INPUT_BLOCK_SIZE;
+	decimator = NULL;
+	combiner = TUNE_AND_SUM;
+	synthesizer = NULL;
+
+	for (int i = 0; i < 2; ++i) {
+		blockReady[i] = false;
+		blockTunedFreqs[i] = tunedFreq;
+		blockTimestamps[i] = 0;
+	}
 
+	// The decimator is used for the sample rate conversion
+	createDecimator();
 
-	// Filter is used for the sample rate conversions
-	float cutOff = (0.5*(sampleRate / MAX_OUTPUT_SAMPLE_RATE)); // normalized frequency
-	filter = new FIRFilter(preFiltArray, postFiltArray, FIRFilter::lowpass, Real(FILTER_ATTENUATION), Real(cutOff));
+	// Sizes the block buffers
+	applyBlockSize();
 
 	// 0.5 because of cast truncation.
 	unsigned int maxSampleRateInt = (unsigned int) (MAX_OUTPUT_SAMPLE_RATE + 0.5);
@@ -109,7 +126,7 @@ FmRdsSimulatorImpl::~FmRdsSimulatorImpl() {
 		alarm = NULL;
 	}
 
-	for (int i = 0; i < transmitters.size(); ++i) {
+	for (size_t i = 0; i < transmitters.size(); ++i) {
 		if (transmitters[i]) {
 			delete(transmitters[i]);
 			transmitters[i] = NULL;
@@ -117,10 +134,22 @@ FmRdsSimulatorImpl::~FmRdsSimulatorImpl() {
 	}
 
 	transmitters.clear();
+	transmitterIndex.clear();
+	activeTransmitters.clear();
 
-	if (filter) {
-		delete(filter);
-		filter = NULL;
+	if (decimator) {
+		delete(decimator);
+		decimator = NULL;
+	}
+
+	if (synthesizer) {
+		delete(synthesizer);
+		synthesizer = NULL;
+	}
+
+	if (noise) {
+		delete(noise);
+		noise = NULL;
 	}
 }
 
@@ -178,6 +207,7 @@ int FmRdsSimulatorImpl::init(std::string cfgFileDir, CallbackInterface * userCla
 
 	this->userClass = userClass;
 	transmitters.clear();
+	transmitterIndex.clear();
 
 	directory_iterator end_itr;
 	// cycle through the directory and save all the XML configurations.
@@ -205,10 +235,23 @@ void FmRdsSimulatorImpl::stop() {
 		return;
 	}
 
+	TRACE("Stopping the block generation pipeline");
+	{
+		boost::lock_guard<boost::mutex> lock(pipelineMutex);
+		pipelineRunning = false;
+	}
+	pipelineCond.notify_all();
+
 	TRACE("Stopping the Boost Async service");
 	// Stop the Boost Asynchronous Service
 	io.stop();
 
+	if (userDataQueue) {
+		TRACE("Shutting down the user data queue");
+		// Wakes the data grabbing thread if it is blocked waiting for queue space
+		userDataQueue->shutDown();
+	}
+
 
 	if (io_service_thread) {
 		TRACE("Joining all io service threads");
@@ -223,12 +266,20 @@ void FmRdsSimulatorImpl::stop() {
 	}
 
 
-	if (userDataQueue) {
-		TRACE("Shutting down the user data queue");
-		// Now shutdown the data queue
-		userDataQueue->shutDown();
+	if (generatorThread) {
+		TRACE("Joining the block generation thread");
+		generatorThread->join();
+		delete(generatorThread);
+		generatorThread = NULL;
+	}
 
+	if (workerPool) {
+		TRACE("Deleting the transmitter worker pool");
+		delete(workerPool);
+		workerPool = NULL;
+	}
 
+	if (userDataQueue) {
 		TRACE("Deleting the user data queue object");
 		delete(userDataQueue);
 		userDataQueue = NULL;
@@ -245,8 +296,13 @@ void FmRdsSimulatorImpl::stop() {
 
 void FmRdsSimulatorImpl::_start() {
 	TRACE("Entered Method");
-	alarm->expires_from_now(boost::posix_time::milliseconds(CALLBACK_INTERVAL));
-	io.run();
+	if (freeRunning) {
+		TRACE("Free running, delivering blocks as fast as they are generated and consumed");
+		while (deliverBlock()) {}
+	} else {
+		alarm->expires_from_now(callbackInterval);
+		io.run();
+	}
 	TRACE("Leaving Method");
 }
 
@@ -258,16 +314,53 @@ void FmRdsSimulatorImpl::start() {
 		return;
 	}
 
-	TRACE("Binding deadline_timer to dataGrab method");
-	alarm->async_wait(boost::bind(&FmRdsSimulatorImpl::dataGrab, this, boost::asio::placeholders::error, alarm));
+	if (not freeRunning) {
+		TRACE("Binding deadline_timer to dataGrab method");
+		alarm->async_wait(boost::bind(&FmRdsSimulatorImpl::dataGrab, this, boost::asio::placeholders::error, alarm));
+	}
 
 	TRACE("Creating a data queue object for user data");
-	userDataQueue = new UserDataQueue(maxQueueSize, this->userClass);
+	if (queueType == LOCK_FREE_RING) {
+		userDataQueue = new RingDataQueue(maxQueueSize, this->userClass, queueSpinTime);
+	} else {
+		userDataQueue = new UserDataQueue(maxQueueSize, this->userClass);
+	}
+
+	// When free running the queue pushes back on the generator rather than dropping data
+	userDataQueue->setOverflowPolicy(freeRunning ? BLOCK_PRODUCER : overflowPolicy);
+	deliveredSamples = 0;
+
+	rendering = false;
+	applyBlockSize();
+
+	{
+		boost::mutex::scoped_lock lock(sampleRateMutex);
+		userDataQueue->reserveBuffers(outputBlockSize());
+	}
+
+	TRACE("Setting the RDS clock of the transmitters");
+	for (size_t i = 0; i < transmitters.size(); ++i) {
+		transmitters[i]->setSimulatedClock(freeRunning);
+	}
 
 	TRACE("Running the data handler in new thread");
 	// This runs in its own thread and waits for data to arrive.
 	userDataQueue->waitForData();
 
+	TRACE("Creating the transmitter worker pool");
+	workerPool = new WorkerPool(numWorkerThreads);
+
+	applyCombiner();
+
+	TRACE("Running the block generation pipeline in new thread");
+	{
+		boost::lock_guard<boost::mutex> lock(pipelineMutex);
+		pipelineRunning = true;
+		blockReady[0] = blockReady[1] = false;
+		outputIndex = 0;
+	}
+	generatorThread = new boost::thread(boost::bind(&FmRdsSimulatorImpl::generatorLoop, this));
+
 	TRACE("Running the asio io-service in new thread");
 	io_service_thread = new boost::thread(boost::bind(&FmRdsSimulatorImpl::_start, this));
 
@@ -280,94 +373,420 @@ void FmRdsSimulatorImpl::dataGrab(const boost::system::error_code& error, boost:
 	TRACE("Entered Method");
 
 	TRACE("Checking Timer isn't overdue by a full cycle");
-	if ( (alarm->expires_from_now() + boost::posix_time::milliseconds(CALLBACK_INTERVAL)).is_negative() ) {
+	if ( (alarm->expires_from_now() + callbackInterval).is_negative() ) {
 		//TODO: Should this be a warning or an error?  Or an exception?
 		WARN("Data delivery is lagging from real-time.  Consider reducing the number of input files.");
 	}
 
 	TRACE("Reseting alarm");
 	// Reset timer
-	alarm->expires_at(alarm->expires_at() + boost::posix_time::milliseconds(CALLBACK_INTERVAL));
+	alarm->expires_at(alarm->expires_at() + callbackInterval);
 	alarm->async_wait(boost::bind(&FmRdsSimulatorImpl::dataGrab, this, boost::asio::placeholders::error, alarm));
 
-	int i;
-	// Kick off all the worker threads
-	TRACE("Starting all of the worker threads");
-	for (i = 0; i < transmitters.size(); ++i) {
-		transmitters[i]->start();
+	deliverBlock();
+
+	TRACE("Leaving Method");
+}
+
+/**
+ * Filters, decimates and delivers the next generated block to the user data queue.
+ * Returns false if the pipeline was stopped while waiting for the block.
+ */
+bool FmRdsSimulatorImpl::deliverBlock() {
+	TRACE("Entered Method");
+	unsigned int index;
+
+	// Wait for the generator to finish the block we are about to deliver
+	{
+		boost::unique_lock<boost::mutex> lock(pipelineMutex);
+		while (not blockReady[outputIndex] && pipelineRunning) {
+			TRACE("Waiting for the block generator");
+			pipelineCond.wait(lock);
+		}
+
+		if (not pipelineRunning) {
+			TRACE("Pipeline is stopping, leaving method");
+			return false;
+		}
+
+		index = outputIndex;
+	}
+
+	BlockMetadata metadata;
+	metadata.sampleIndex = deliveredSamples;
+	metadata.timestamp = blockTimestamps[index];
+	metadata.centerFrequency = blockTunedFreqs[index];
+	metadata.flags = 0;
+
+	// Decimate straight into a pooled buffer, the queue passes it on to the user without copying
+	SampleBufferPool::Buffer buffer;
+
+	{
+		boost::mutex::scoped_lock lock(sampleRateMutex);
+		metadata.sampleRate = sampleRate;
+		metadata.gain = gain;
+		buffer = userDataQueue->getBuffer(outputBlockSize());
+		decimateBlock(index, &(*buffer)[0], metadata.gain);
+	}
+
+	TRACE("Delivering " << buffer->size() << " data points to data queue.");
+	userDataQueue->deliverData(buffer, metadata);
+	deliveredSamples += buffer->size();
+	buffer.reset();
+
+	// Hand the buffer back to the generator
+	{
+		boost::lock_guard<boost::mutex> lock(pipelineMutex);
+		blockReady[index] = false;
+		outputIndex = (outputIndex + 1) % 2;
+	}
+	pipelineCond.notify_all();
+
+	TRACE("Leaving Method");
+	return true;
+}
+
+/**
+ * The number of samples decimateBlock will produce from the next block.  The sampleRateMutex
+ * must be held and remain held until decimateBlock is called.
+ */
+size_t FmRdsSimulatorImpl::outputBlockSize() {
+	// RHWEB-117 - The decimator tracks the start index for decimation to prevent phase slip.
+	// The size of the output depends on the puncture rate and the start index of the last puncture.
+	return decimator->outputSize(preFiltArrays[0].size());
+}
+
+/**
+ * Replaces the decimator with one for the current sample rate.  The sampleRateMutex must be held.
+ */
+void FmRdsSimulatorImpl::createDecimator() {
+	TRACE("Entered Method");
+	// So if the max rate was 1,000 and we want a sample rate of 250
+	// the puncture rate would be 4, we would keep 1 out of every 4 samples.
+	unsigned int pr = MAX_OUTPUT_SAMPLE_RATE/sampleRate;
+
+	if (decimator) {
+		TRACE("Deleting current decimator");
+		delete(decimator);
+		decimator = NULL;
+	}
+
+	// Large rate reductions are split into stages, each filter sized for the attenuation
+	decimator = new MultistageDecimator(pr, Real(OUTPUT_PASSBAND), Real(FILTER_ATTENUATION));
+	TRACE("Created decimator by " << pr << " with " << decimator->numStages() << " stages and "
+			<< decimator->multipliesPerOutput() << " multiplies per output sample and a noise bandwidth of "
+			<< decimator->noiseBandwidth());
+	TRACE("Leaving Method");
+}
+
+/**
+ * Decimates the generated block in the given ping-pong buffer and adds noise, writing
+ * outputBlockSize() samples with blockGain applied to out.  The sampleRateMutex must be held.
+ */
+void FmRdsSimulatorImpl::decimateBlock(unsigned int index, std::complex<float> *out, float blockGain) {
+	TRACE("Entered Method");
+	std::valarray<std::complex<float> > &preFiltArray = preFiltArrays[index];
+
+	// Only the samples that are kept are filtered.  The decimator keeps [skip..skip...puncture]
+	// and carries the puncture index and filter history over to the next block.
+	size_t newsize = decimator->run(preFiltArray, out);
+
+	// noiseSigma is the noise at 2.28 Msps.  Filtered and decimated, its power would be scaled by
+	// the decimator's noise gain and spread over the decimator's noise equivalent bandwidth.  White
+	// noise across the whole output band with the same density in the passband is added instead.
+	if (shouldAddNoise) {
+		boost::mutex::scoped_lock lock(noiseMutex);
+		noise->setSigma(noiseSigma * sqrtf(decimator->noiseGain() / decimator->noiseBandwidth()));
+		noise->add(out, newsize);
 	}
 
-	// Join them back up.
-	TRACE("Joining all the worker threads back to the main process");
-	for (i = 0; i < transmitters.size(); ++i) {
-		transmitters[i]->join();
+	float linearGain = powf(10.0, blockGain/10.0);
+	for (size_t i = 0; i < newsize; ++i) {
+		out[i] *= linearGain;
 	}
 
-	// Clear out the old data
-	preFiltArray *= 0;
+	TRACE("Leaving Method");
+}
+
+size_t FmRdsSimulatorImpl::render(std::complex<float> *out, size_t numSamples) {
+	TRACE("Entered Method");
+
+	if (not initialized) {
+		ERROR("Simulator must be initialized before rendering");
+		return 0;
+	}
+
+	if (not stopped) {
+		WARN("Render cannot be used while the simulator is started.  Call stop first");
+		return 0;
+	}
+
+	applyBlockSize();
+	applyCombiner();
+
+	if (not rendering) {
+		TRACE("Switching transmitters to the simulated RDS clock");
+		for (size_t i = 0; i < transmitters.size(); ++i) {
+			transmitters[i]->setSimulatedClock(true);
+		}
+		rendering = true;
+	}
+
+	size_t written = 0;
+
+	while (written < numSamples) {
+		// First hand out anything left over from the last block
+		if (renderBufferPos < renderBuffer.size()) {
+			size_t count = std::min(renderBuffer.size() - renderBufferPos, numSamples - written);
+			std::copy(&renderBuffer[renderBufferPos], &renderBuffer[renderBufferPos] + count, out + written);
+			renderBufferPos += count;
+			written += count;
+			continue;
+		}
+
+		generateBlock(preFiltArrays[0]);
 
-	// Collect the data and add it to the return vector
-	TRACE("Collecting data");
-	for (i = 0; i < transmitters.size(); ++i) {
-		std::valarray< std::complex<float> > &txData = transmitters[i]->getData();
-		TRACE("Collected: " << txData.size() << " samples from: " << transmitters[i]->getFilePath());
+		boost::mutex::scoped_lock lock(sampleRateMutex);
+		size_t outputSize = outputBlockSize();
 
-		if (txData.size() != preFiltArray.size()) {
-			WARN("Vector size miss-match on transmitter: " << transmitters[i]->getFilePath().string())
-			WARN("Vector size provided: " << txData.size());
+		if (numSamples - written >= outputSize) {
+			// Decimate straight into the user's buffer
+			decimateBlock(0, out + written, gain);
+			written += outputSize;
 		} else {
-			TRACE("Combining data with current collection");
-			preFiltArray += txData;
+			if (renderBuffer.size() != outputSize) {
+				renderBuffer.resize(outputSize);
+			}
+			decimateBlock(0, &renderBuffer[0], gain);
+			renderBufferPos = 0;
 		}
 	}
 
-	if (shouldAddNoise) {
+	TRACE("Leaving Method");
+	return written;
+}
+
+/**
+ * Runs in its own thread, generating the next block of transmitter data into whichever of the
+ * ping-pong buffers is free.  While dataGrab filters, decimates and delivers block N from one
+ * buffer, block N+1 is being generated into the other.
+ */
+void FmRdsSimulatorImpl::generatorLoop() {
+	TRACE("Entered Method");
+	unsigned int index = 0;
+
+	while (true) {
 		{
-			boost::mutex::scoped_lock lock(noiseArrayMutex);
-			preFiltArray += awgnNoise;
+			boost::unique_lock<boost::mutex> lock(pipelineMutex);
+			while (blockReady[index] && pipelineRunning) {
+				pipelineCond.wait(lock);
+			}
+
+			if (not pipelineRunning) {
+				break;
+			}
+		}
+
+		// Stamped as generation starts, when the tuned frequency and transmitter state are sampled
+		blockTimestamps[index] = (boost::posix_time::microsec_clock::universal_time() - boost::posix_time::from_time_t(0)).total_microseconds() / 1e6;
+		blockTunedFreqs[index] = generateBlock(preFiltArrays[index]);
+
+		{
+			boost::lock_guard<boost::mutex> lock(pipelineMutex);
+			blockReady[index] = true;
 		}
+		pipelineCond.notify_all();
+
+		index = (index + 1) % 2;
 	}
 
+	TRACE("Leaving Method");
+}
+
+/**
+ * Generates the next block of the composite at the maximum sample rate into preFiltArray.
+ * Returns the center frequency it was generated at.
+ */
+float FmRdsSimulatorImpl::generateBlock(std::valarray<std::complex<float> > &preFiltArray) {
+	TRACE("Entered Method");
+
+	size_t i;
+	float halfBandwidth, blockTunedFreq;
+
 	{
 		boost::mutex::scoped_lock lock(sampleRateMutex);
-		// So if the max rate was 1,000 and we want a sample rate of 250
-		// the puncture rate would be 4, we would keep 1 out of every 4 samples.
-		unsigned int pr = MAX_OUTPUT_SAMPLE_RATE/sampleRate;
+		halfBandwidth = 0.5 * sampleRate;
+	}
 
-		filter->run();
+	{
+		boost::mutex::scoped_lock lock(tunedFreqMutex);
+		blockTunedFreq = tunedFreq;
+	}
 
+	std::vector<Transmitter*> previousTransmitters;
+	previousTransmitters.swap(activeTransmitters);
 
-		// RHWEB-117 - Track the start index for decimation to prevent phase slip.
-		// The size of the output valarray depends on the puncture rate and the start index
-		// of the last puncture.
+	for (i = 0; i < previousTransmitters.size(); ++i) {
+		previousTransmitters[i]->deactivate();
+	}
 
-		int newsize = (postFiltArray.size() - pi) / pr;
+	// Only stations with some part of their spectrum inside the output bandwidth are generated and mixed.
+	// They are found from the frequency index so the cost does not depend on the number of stations loaded.
+	TRACE("Building the set of active transmitters");
+	float span = std::min(halfBandwidth + TRANSMITTER_HALF_BANDWIDTH, 0.5 * MAX_OUTPUT_SAMPLE_RATE);
+	std::multimap<float, Transmitter*>::iterator it = transmitterIndex.lower_bound(blockTunedFreq - span);
+	std::multimap<float, Transmitter*>::iterator end = transmitterIndex.upper_bound(blockTunedFreq + span);
 
-		// The easiest way to track and adjust the puncture index is to to [skip..skip...puncture]
-		// rather than [puncture..skip..skip].  The logic just works out easier.  So the slice starts
-		// at puncture rate - puncture index - 1 (the -1 is on the pr since we index by 0)
-		std::valarray<std::complex<float> > retVec = postFiltArray[std::slice(pr-pi-1, newsize, pr)];
+	for (; it != end; ++it) {
+		if (it->second->beginBlock(blockTunedFreq, halfBandwidth)) {
+			activeTransmitters.push_back(it->second);
+		}
+	}
 
-		// The logic to determining the new pi (puncture index) is non-trivial but here is the logic:
-		// It's easier to think about if puncture index is 0.
-		// We want the size given (postFiltArray) minus our size out times the puncture rate.  So,
-		// if we were given 10 points, 0-9, punctured every third we'd end up with 3 points,
-		// [2, 5, 8] and 10 - 3*3 = 1
-		// so on our next path we should start puncturing at index 1.
-		// The new pi is taken into account by adding it to the size of the given array and the whole thing is
-		// mod pr for when it carries over.
+	// Stations that have left the band give up their DSP buffers
+	for (i = 0; i < previousTransmitters.size(); ++i) {
+		if (not previousTransmitters[i]->isActive()) {
+			previousTransmitters[i]->releaseBuffers();
+		}
+	}
+
+	// Hand each active transmitter to the worker pool
+	TRACE("Posting " << activeTransmitters.size() << " of " << transmitters.size() << " transmitters to the worker pool");
+	for (i = 0; i < activeTransmitters.size(); ++i) {
+		runJob(boost::bind(&Transmitter::generate, activeTransmitters[i]));
+	}
+
+	// Wait for all of them to complete.
+	TRACE("Waiting for the worker pool to generate the block");
+	waitForJobs();
+
+	if (synthesizer) {
+		synthesizeTransmitters(preFiltArray);
+		TRACE("Leaving Method");
+		return blockTunedFreq;
+	}
 
-		pi = ((postFiltArray.size() + pi) - retVec.size()*pr) % pr;
+	for (i = 0; i < activeTransmitters.size(); ++i) {
+		if (activeTransmitters[i]->isActive() && activeTransmitters[i]->getBlockSize() != preFiltArray.size()) {
+			WARN("Vector size miss-match on transmitter: " << activeTransmitters[i]->getFilePath().string())
+			WARN("Vector size provided: " << activeTransmitters[i]->getBlockSize());
+		}
+	}
 
-		// Apply gain factor
-		float linearGain = powf(10.0, gain/10.0);
-		retVec *= linearGain;
+	// Every station is shifted and added straight into the composite.  The composite is split into sample
+	// ranges, each mixed by one worker, so the workers never write the same samples.
+	TRACE("Posting the mixing of all active transmitters to the worker pool");
+	for (size_t first = 0; first < preFiltArray.size(); first += MIX_CHUNK_SIZE) {
+		size_t count = std::min((size_t) MIX_CHUNK_SIZE, preFiltArray.size() - first);
+		runJob(boost::bind(&FmRdsSimulatorImpl::mixTransmitters, this, &preFiltArray, first, count));
+	}
 
+	TRACE("Waiting for the worker pool to mix the block");
+	waitForJobs();
 
-		TRACE("Delivering " << retVec.size() << " data points to data queue.");
-		userDataQueue->deliverData(retVec);
+	for (i = 0; i < activeTransmitters.size(); ++i) {
+		activeTransmitters[i]->finishBlock();
 	}
 
+	TRACE("Leaving Method");
+	return blockTunedFreq;
+}
+
+/**
+ * Posts the job to the worker pool or, when rendering on the caller's thread, runs it immediately.
+ */
+void FmRdsSimulatorImpl::runJob(const WorkerPool::Job &job) {
+	if (workerPool) {
+		workerPool->post(job);
+	} else {
+		job();
+	}
+}
+
+void FmRdsSimulatorImpl::waitForJobs() {
+	if (workerPool) {
+		workerPool->wait();
+	}
+}
+
+/**
+ * Shifts a range of samples from every transmitter in the active set and sums them into the given array.
+ */
+void FmRdsSimulatorImpl::mixTransmitters(std::valarray<std::complex<float> > *preFiltArray, size_t first, size_t count) {
+	std::complex<float> *out = &(*preFiltArray)[first];
+
+	for (size_t ii = 0; ii < count; ++ii) {
+		out[ii] = std::complex<float>(0.0, 0.0);
+	}
+
+	for (size_t i = 0; i < activeTransmitters.size(); ++i) {
+		if (not activeTransmitters[i]->isActive() || activeTransmitters[i]->getBlockSize() != preFiltArray->size()) {
+			continue;
+		}
+
+		activeTransmitters[i]->mix(first, count, out);
+	}
+}
+
+/**
+ * Interpolates, shifts and sums the active transmitters into the given array with the FFT synthesizer.
+ * The frames of the block are split into one range per workspace, each synthesized by a worker.
+ */
+void FmRdsSimulatorImpl::synthesizeTransmitters(std::valarray<std::complex<float> > &preFiltArray) {
+	TRACE("Entered Method");
+
+	std::vector<FftSynthesizer::Channel*> channels;
+	size_t numIn = preFiltArray.size() / INTERPOLATION_FACTOR;
+
+	for (size_t i = 0; i < activeTransmitters.size(); ++i) {
+		activeTransmitters[i]->finishBlock();
+
+		if (activeTransmitters[i]->isActive()) {
+			channels.push_back(activeTransmitters[i]->getChannel());
+		}
+	}
+
+	TRACE("Posting the synthesis of " << channels.size() << " transmitters to the worker pool");
+	for (size_t i = 0; i < synthesizer->numWorkspaces(); ++i) {
+		runJob(boost::bind(&FftSynthesizer::run, synthesizer, boost::cref(channels), numIn, &preFiltArray[0], i));
+	}
+
+	waitForJobs();
+
+	synthesizer->finishBlock(channels, numIn, &preFiltArray[0]);
+
+	TRACE("Leaving Method");
+}
+
+/**
+ * Switches the transmitters to the chosen combiner and, for FFT synthesis, sizes the synthesizer to one
+ * range of frames per worker.  The simulator must not be generating.
+ */
+void FmRdsSimulatorImpl::applyCombiner() {
+	TRACE("Entered Method");
+	bool synthesize = (combiner == FFT_SYNTHESIS);
+
+	for (size_t i = 0; i < transmitters.size(); ++i) {
+		transmitters[i]->setSynthesized(synthesize);
+	}
+
+	if (not synthesize) {
+		if (synthesizer) {
+			TRACE("Deleting the FFT synthesizer");
+			delete(synthesizer);
+			synthesizer = NULL;
+		}
+		TRACE("Leaving Method");
+		return;
+	}
+
+	if (not synthesizer) {
+		TRACE("Creating the FFT synthesizer");
+		synthesizer = new FftSynthesizer(INTERPOLATION_FACTOR, Transmitter::getInterpolationFilter(), SYNTHESIS_FFT_SIZE, FILTER_ATTENUATION);
+	}
+
+	synthesizer->setNumWorkspaces(workerPool ? workerPool->size() : 1);
+
 	TRACE("Leaving Method");
 }
 
@@ -504,7 +923,7 @@ int FmRdsSimulatorImpl::loadCfgFile(path filePath) {
 		}
 
 		TRACE("Initializing the Transmitter object");
-		if (tx->init(centerFreq, FILE_INPUT_BLOCK_SIZE) != 0) {
+		if (tx->init(centerFreq, blockSize) != 0) {
 			TRACE("Something went wrong.  Deleting the transmitter object");
 			delete(tx);
 			tx = NULL;
@@ -518,6 +937,7 @@ int FmRdsSimulatorImpl::loadCfgFile(path filePath) {
 
 		TRACE("Pushing the transmitter object onto the vector of transmitters");
 		transmitters.push_back(tx);
+		transmitterIndex.insert(std::make_pair(centerFreq, tx));
 		TRACE("Stored following: " << *tx);
 
 	} else {
@@ -546,6 +966,197 @@ void FmRdsSimulatorImpl::setQueueSize(unsigned short queueSize) {
 }
 
 
+void FmRdsSimulatorImpl::setQueueType(QueueType type) {
+	TRACE("Entered Method");
+	queueType = type;
+
+	if (not stopped) {
+		INFO("Queue type will be updated on the next call to start");
+	}
+
+	TRACE("Leaving Method");
+}
+
+QueueType FmRdsSimulatorImpl::getQueueType() {
+	TRACE("Entered Method");
+	TRACE("Leaving Method");
+	return queueType;
+}
+
+void FmRdsSimulatorImpl::setQueueSpinTime(unsigned int microseconds) {
+	TRACE("Entered Method");
+	queueSpinTime = microseconds;
+
+	if (not stopped) {
+		INFO("Queue spin time will be updated on the next call to start");
+	}
+
+	TRACE("Leaving Method");
+}
+
+unsigned int FmRdsSimulatorImpl::getQueueSpinTime() {
+	TRACE("Entered Method");
+	TRACE("Leaving Method");
+	return queueSpinTime;
+}
+
+QueueStatistics FmRdsSimulatorImpl::getQueueStatistics() {
+	TRACE("Entered Method");
+	QueueStatistics stats;
+	if (userDataQueue) {
+		stats = userDataQueue->getStatistics();
+	} else {
+		memset(&stats, 0, sizeof(stats));
+	}
+	TRACE("Leaving Method");
+	return stats;
+}
+
+void FmRdsSimulatorImpl::setOverflowPolicy(OverflowPolicy policy) {
+	TRACE("Entered Method");
+	overflowPolicy = policy;
+
+	if (userDataQueue && not freeRunning) {
+		userDataQueue->setOverflowPolicy(policy);
+	}
+
+	TRACE("Leaving Method");
+}
+
+OverflowPolicy FmRdsSimulatorImpl::getOverflowPolicy() {
+	TRACE("Entered Method");
+	TRACE("Leaving Method");
+	return overflowPolicy;
+}
+
+std::vector<QueueGap> FmRdsSimulatorImpl::getQueueGaps() {
+	TRACE("Entered Method");
+	std::vector<QueueGap> gaps;
+	if (userDataQueue) {
+		gaps = userDataQueue->getGaps();
+	}
+	TRACE("Leaving Method");
+	return gaps;
+}
+
+void FmRdsSimulatorImpl::setNumWorkerThreads(unsigned int numThreads) {
+	TRACE("Entered Method");
+	numWorkerThreads = numThreads;
+
+	if (not stopped) {
+		INFO("Number of worker threads will be updated on the next call to start");
+	}
+
+	TRACE("Leaving Method");
+}
+
+unsigned int FmRdsSimulatorImpl::getNumWorkerThreads() {
+	TRACE("Entered Method");
+	TRACE("Leaving Method");
+	if (workerPool) {
+		return workerPool->size();
+	}
+	return numWorkerThreads;
+}
+
+void FmRdsSimulatorImpl::setFreeRunning(bool freeRunning) {
+	TRACE("Entered Method");
+	this->freeRunning = freeRunning;
+
+	if (not stopped) {
+		INFO("Free running mode will be updated on the next call to start");
+	}
+
+	TRACE("Leaving Method");
+}
+
+bool FmRdsSimulatorImpl::isFreeRunning() {
+	TRACE("Entered Method");
+	TRACE("Leaving Method");
+	return freeRunning;
+}
+
+void FmRdsSimulatorImpl::setCombiner(Combiner combiner) {
+	TRACE("Entered Method");
+	this->combiner = combiner;
+
+	if (not stopped) {
+		INFO("Combiner will be updated on the next call to start");
+	}
+
+	TRACE("Leaving Method");
+}
+
+Combiner FmRdsSimulatorImpl::getCombiner() {
+	TRACE("Entered Method");
+	TRACE("Leaving Method");
+	return combiner;
+}
+
+void FmRdsSimulatorImpl::setBlockSize(unsigned int numSamples) throw(InvalidValue) {
+	TRACE("Entered Method");
+	if (numSamples < MIN_INPUT_BLOCK_SIZE) {
+		WARN("User requested block size of " << numSamples << " is lower than min: " << MIN_INPUT_BLOCK_SIZE);
+		throw InvalidValue();
+	}
+
+	blockSize = numSamples;
+
+	if (not stopped) {
+		INFO("Block size will be updated on the next call to start");
+	}
+
+	TRACE("Leaving Method");
+}
+
+unsigned int FmRdsSimulatorImpl::getBlockSize() {
+	TRACE("Entered Method");
+	TRACE("Leaving Method");
+	return blockSize;
+}
+
+/**
+ * Resizes the transmitter, filter and noise buffers to the requested block size.  The simulator
+ * must not be started.
+ */
+void FmRdsSimulatorImpl::applyBlockSize() {
+	TRACE("Entered Method");
+	// The transmitters upsample by a factor of 10 from the base sample rate
+	size_t outputSize = blockSize * 10;
+
+	if (preFiltArrays[0].size() == outputSize) {
+		TRACE("Block size is unchanged");
+		return;
+	}
+
+	TRACE("Setting block size to " << blockSize << " samples");
+	for (size_t i = 0; i < transmitters.size(); ++i) {
+		transmitters[i]->setBlockSize(blockSize);
+	}
+
+	{
+		boost::mutex::scoped_lock lock(sampleRateMutex);
+		for (int i = 0; i < 2; ++i) {
+			preFiltArrays[i].resize(outputSize, complex<float> (0.0, 0.0));
+		}
+	}
+
+	// Call back interval is 1s / (samplerate / samples per block)
+	callbackInterval = boost::posix_time::microseconds((long) (1e6 * blockSize / BASE_SAMPLE_RATE + 0.5));
+
+	TRACE("Leaving Method");
+}
+
+std::vector<WorkerStatistics> FmRdsSimulatorImpl::getWorkerStatistics() {
+	TRACE("Entered Method");
+	std::vector<WorkerStatistics> stats;
+	if (workerPool) {
+		stats = workerPool->getStatistics();
+	}
+	TRACE("Leaving Method");
+	return stats;
+}
+
 void FmRdsSimulatorImpl::setCenterFrequency(float freq) throw(OutOfRangeException){
 	TRACE("Entered Method");
 
@@ -554,10 +1165,10 @@ void FmRdsSimulatorImpl::setCenterFrequency(float freq) throw(OutOfRangeExceptio
 		throw OutOfRangeException();
 	}
 
-	tunedFreq = freq;
-
-	for (int i = 0; i < transmitters.size(); ++i) {
-		transmitters[i]->setTunedFrequency(tunedFreq);
+	{
+		// The transmitters in band are retuned by the generator at the start of the next block
+		boost::mutex::scoped_lock lock(tunedFreqMutex);
+		tunedFreq = freq;
 	}
 
 	TRACE("Leaving Method");
@@ -577,7 +1188,11 @@ void FmRdsSimulatorImpl::setGain(float gain) throw(OutOfRangeException) {
 	}
 
 	INFO("Setting gain to " << gain);
-	this->gain = gain;
+	{
+		// Applied as each block is decimated
+		boost::mutex::scoped_lock lock(sampleRateMutex);
+		this->gain = gain;
+	}
 	TRACE("Leaving Method");
 }
 
@@ -618,17 +1233,7 @@ void FmRdsSimulatorImpl::setSampleRate(unsigned int sampleRate) throw(InvalidVal
 		boost::mutex::scoped_lock lock(sampleRateMutex);
 		TRACE("filterMutex Locked")
 		this->sampleRate = closestSampleRate;
-
-		TRACE("Deleting current filter")
-		if (filter) {
-			delete(filter);
-			filter = NULL;
-		}
-
-		float cutOff = (0.5*(closestSampleRate / MAX_OUTPUT_SAMPLE_RATE)); // normalized frequency
-
-		TRACE("Creating new filter with cut off of " << cutOff);
-		filter = new FIRFilter(preFiltArray, postFiltArray, FIRFilter::lowpass, Real(FILTER_ATTENUATION), cutOff);
+		createDecimator();
 	}
 
 	TRACE("Leaving Method");
@@ -666,8 +1271,8 @@ void FmRdsSimulatorImpl::setNoiseSigma(float noiseSigma) {
 		WARN("Negative standard deviation does not make sense.  Using absolute value.")
 	}
 
+	boost::mutex::scoped_lock lock(noiseMutex);
 	this->noiseSigma = fabs(noiseSigma);
-	fillNoiseArray();
 	TRACE("Leaving Method");
 }
 
@@ -677,18 +1282,19 @@ float FmRdsSimulatorImpl::getNoiseSigma() {
 	return noiseSigma;
 }
 
-void FmRdsSimulatorImpl::fillNoiseArray() {
+void FmRdsSimulatorImpl::setNoiseSeed(unsigned int seed) {
 	TRACE("Entered Method");
-	boost::variate_generator<boost::mt19937, boost::normal_distribution<float> > generator(boost::mt19937(time(0)), boost::normal_distribution<float>(0.0, noiseSigma));
+	boost::mutex::scoped_lock lock(noiseMutex);
+	noise->setSeed(seed);
+	noise->seek(0);
+	TRACE("Leaving Method");
+}
 
-	{
-		TRACE("Filling awgnNoise array");
-		boost::mutex::scoped_lock lock(noiseArrayMutex);
-		for (int i = 0; i < awgnNoise.size(); ++i) {
-			awgnNoise[i] = std::complex<float>(generator(), generator());
-		}
-	}
+unsigned int FmRdsSimulatorImpl::getNoiseSeed() {
+	TRACE("Entered Method");
+	boost::mutex::scoped_lock lock(noiseMutex);
 	TRACE("Leaving Method");
+	return (unsigned int) noise->seed();
 }
 
 }
@@ -30,8 +30,25 @@
 #define PI 3.141592654
 
 
-#define FIR_HALF_SIZE 30
-#define FIR_SIZE (2*FIR_HALF_SIZE-1)
+#define AUDIO_READ_FRAMES 4096
+
+// The audio is resampled to 228 kHz in two steps.  A polyphase low-pass
+// filter with AUDIO_FILTER_TAPS taps per phase first interpolates it by
+// AUDIO_UPSAMPLE, UPSAMPLE_INPUTS audio samples at a time, and a cubic
+// interpolator then takes the result to the multiplex rate.
+#define AUDIO_UPSAMPLE 4
+#define AUDIO_FILTER_TAPS 24
+#define UPSAMPLE_INPUTS 128
+
+// Samples of the upsampled audio the cubic interpolator works across
+#define CUBIC_POINTS 4
+
+// Samples of the multiplex generated per pass
+#define MPX_CHUNK 512
+
+// Samples in one period of the pilot, which also holds whole periods of the
+// 38 kHz subcarrier
+#define CARRIER_PERIOD 12
 
 static const float carrier_38[] = {0.0, 0.8660254037844386, 0.8660254037844388, 1.2246467991473532e-16, -0.8660254037844384, -0.8660254037844386};
 static const float carrier_19[] = {0.0, 0.5, 0.8660254037844386, 1.0, 0.8660254037844388, 0.5, 1.2246467991473532e-16, -0.5, -0.8660254037844384, -1.0, -0.8660254037844386, -0.5};
@@ -41,23 +58,35 @@ static const float carrier_19[] = {0.0, 0.5, 0.8660254037844386, 1.0, 0.86602540
 
 struct fm_mpx_struct {
 	size_t length;
-	// coefficients of the low-pass FIR filter
-	float low_pass_fir[FIR_HALF_SIZE];
+	size_t audio_read_len;
+	// coefficients of the polyphase low-pass filter, AUDIO_FILTER_TAPS rows
+	// of AUDIO_UPSAMPLE, so that a row holds one tap of every phase
+	float *upsample_taps;
 	int phase_38;
 	int phase_19;
-	float downsample_factor;
+	double resample_step;	// upsampled audio samples per multiplex sample
+	double resample_time;	// position of the next output in the upsampled audio
 	float *audio_buffer;
+	// the mono (or stereo sum) and stereo difference audio, audio_len
+	// samples of each, of which audio_index is the first under the filter
+	float *audio_mono;
+	float *audio_stereo;
 	int audio_index;
 	int audio_len;
-	float audio_pos;
-	float fir_buffer_mono[FIR_SIZE];
-	float fir_buffer_stereo[FIR_SIZE];
-	int fir_index;
+	// the upsampled audio, up_len samples of each
+	float up_mono[CUBIC_POINTS - 1 + AUDIO_UPSAMPLE * UPSAMPLE_INPUTS];
+	float up_stereo[CUBIC_POINTS - 1 + AUDIO_UPSAMPLE * UPSAMPLE_INPUTS];
+	int up_len;
+	// two periods of the scaled pilot and subcarrier, so that a period can be
+	// read from any phase without wrapping
+	double pilot_19[2 * CARRIER_PERIOD];
+	double subcarrier_38[2 * CARRIER_PERIOD];
 	int channels;
 	SNDFILE *inf;
 };
 
 extern int fm_mpx_open(char *filename, size_t len, struct fm_mpx_struct * fm_mpx_status);
+extern void fm_mpx_set_length(size_t len, struct fm_mpx_struct * fm_mpx_status);
 extern int fm_mpx_get_samples(float *mpx_buffer, struct rds_content_struct* rds_params, struct rds_signal_info* rds_signal, struct fm_mpx_struct * fm_mpx_status);
 extern int fm_mpx_close(struct fm_mpx_struct * fm_mpx_status);
 
@@ -23,6 +23,7 @@
 
 
 #include <stdint.h>
+#include <time.h>
 #include "waveforms.h"
 
 #define RT_LENGTH 64
@@ -45,7 +46,11 @@
 #define BITS_PER_GROUP (GROUP_LENGTH * (BLOCK_SIZE+POLY_DEG))
 #define SAMPLES_PER_BIT 192
 #define FILTER_SIZE (sizeof(waveform_biphase)/sizeof(float))
-#define SAMPLE_BUFFER_SIZE (SAMPLES_PER_BIT + FILTER_SIZE)
+// The number of bits whose waveforms overlap any one sample, and the number of sign
+// patterns they can take
+#define SEGMENT_BITS (FILTER_SIZE / SAMPLES_PER_BIT)
+#define SEGMENT_PATTERNS (1 << SEGMENT_BITS)
+#define RDS_SAMPLE_RATE 228000
 
 
 struct rds_content_struct {
@@ -62,24 +67,31 @@ struct rds_content_struct {
 struct rds_signal_info {
 	int bit_buffer[BITS_PER_GROUP];
 	int bit_pos;
-	float sample_buffer[SAMPLE_BUFFER_SIZE];
+	// The modulated samples of one bit period for each pattern of the differentially
+	// encoded bits that overlap it, the newest in the lowest bit.
+	float segments[SEGMENT_PATTERNS][SAMPLES_PER_BIT];
+	int history;
+	int history_bits;
 	int prev_output;
 	int cur_output;
 	int cur_bit;
 	int sample_count;
-	int inverting;
-	int phase;
-	int in_sample_index;
-	int out_sample_index;
 	int latest_minutes;
 	int state;
 	int ps_state;
 	int rt_state;
+	// When use_sim_clock is set the CT group is derived from the number of samples generated
+	// since sim_clock_start rather than from the wall clock.
+	int use_sim_clock;
+	time_t sim_clock_start;
+	unsigned long long sample_counter;
 };
 
+extern void init_rds_signal(struct rds_signal_info * rds_signal);
 extern void get_rds_samples(float *buffer, int count, struct rds_content_struct* rds_content, struct rds_signal_info * rds_signal);
 extern void set_rds_rt(char *rt, struct rds_content_struct* rds_params);
 extern void set_rds_ps(char *ps, struct rds_content_struct* rds_params);
 extern void set_rds_ta(int ta);
+extern void set_rds_sim_clock(int use_sim_clock, struct rds_signal_info * rds_signal);
 
 #endif /* RDS_H */
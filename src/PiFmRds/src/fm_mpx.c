@@ -25,10 +25,14 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 #include <strings.h>
 #include <math.h>
 #include "fm_mpx.h"
 
+// Audio samples interpolated side by side
+#define UPSAMPLE_GROUP 4
+
 float *alloc_empty_buffer(size_t length) {
     float *p = malloc(length * sizeof(float));
     if(p == NULL) return NULL;
@@ -41,6 +45,17 @@ float *alloc_empty_buffer(size_t length) {
 
 int fm_mpx_open(char *filename, size_t len, struct fm_mpx_struct* fm_mpx_status) {
 	fm_mpx_status->length = len;
+	fm_mpx_status->upsample_taps = NULL;
+	fm_mpx_status->audio_buffer = NULL;
+	fm_mpx_status->audio_mono = NULL;
+	fm_mpx_status->audio_stereo = NULL;
+
+    // Scale the carriers once rather than on every sample
+    int k;
+    for(k=0; k<2*CARRIER_PERIOD; k++) {
+        fm_mpx_status->pilot_19[k] = .9*carrier_19[k % 12];
+        fm_mpx_status->subcarrier_38[k] = 4.05 * carrier_38[k % 6];
+    }
 
     if(filename != NULL) {
         // Open the input file
@@ -65,9 +80,9 @@ int fm_mpx_open(char *filename, size_t len, struct fm_mpx_struct* fm_mpx_status)
         }
             
         int in_samplerate = sfinfo.samplerate;
-        fm_mpx_status->downsample_factor = 228000. / in_samplerate;
+        fm_mpx_status->resample_step = AUDIO_UPSAMPLE * in_samplerate / 228000.;
     
-//        printf("Input: %d Hz, upsampling factor: %.2f\n", in_samplerate, fm_mpx_status->downsample_factor);
+//        printf("Input: %d Hz, upsampling factor: %.2f\n", in_samplerate, 228000. / in_samplerate);
 
         fm_mpx_status->channels = sfinfo.channels;
 //        if(fm_mpx_status->channels > 1) {
@@ -81,32 +96,45 @@ int fm_mpx_open(char *filename, size_t len, struct fm_mpx_struct* fm_mpx_status)
         float cutoff_freq = 15000 * .8;
         if(in_samplerate/2 < cutoff_freq) cutoff_freq = in_samplerate/2 * .8;
     
-    
-    
-        fm_mpx_status->low_pass_fir[FIR_HALF_SIZE-1] = 2 * cutoff_freq / 228000 /2;
-        // Here we divide this coefficient by two because it will be counted twice
-        // when applying the filter
-
-        // Only store half of the filter since it is symmetric
-        int i;
-        for(i=1; i<FIR_HALF_SIZE; i++) {
-        	fm_mpx_status->low_pass_fir[FIR_HALF_SIZE-1-i] =
-                sin(2 * PI * cutoff_freq * i / 228000) / (PI * i)      // sinc
-                * (.54 - .46 * cos(2*PI * (i+FIR_HALF_SIZE) / (2*FIR_HALF_SIZE)));
-                                                              // Hamming window
+        // The filter is designed at AUDIO_UPSAMPLE times the audio rate and
+        // split into phases, so each output only touches the audio samples
+        // themselves rather than the copies a zero-order hold would make of
+        // them.  Tap k of phase p weights the kth audio sample under the
+        // filter for the output p / AUDIO_UPSAMPLE of a sample past its middle.
+        fm_mpx_status->upsample_taps = alloc_empty_buffer(AUDIO_FILTER_TAPS * AUDIO_UPSAMPLE);
+        if(fm_mpx_status->upsample_taps == NULL) return -1;
+
+        double fc = cutoff_freq / in_samplerate;
+        int p;
+        for(p=0; p<AUDIO_UPSAMPLE; p++) {
+            double sum = 0;
+            for(k=0; k<AUDIO_FILTER_TAPS; k++) {
+                // distance of this tap's audio sample from the output, in audio samples
+                double d = k - (AUDIO_FILTER_TAPS/2 - 1) - (double) p / AUDIO_UPSAMPLE;
+                double h = (d == 0) ? 2 * fc : sin(2 * PI * fc * d) / (PI * d);     // sinc
+                h *= .54 + .46 * cos(2 * PI * d / AUDIO_FILTER_TAPS);               // Hamming window
+                fm_mpx_status->upsample_taps[k * AUDIO_UPSAMPLE + p] = h;
+                sum += h;
+            }
+            // Unity gain at DC for every phase
+            for(k=0; k<AUDIO_FILTER_TAPS; k++) {
+                fm_mpx_status->upsample_taps[k * AUDIO_UPSAMPLE + p] /= sum;
+            }
         }
 //        printf("Created low-pass FIR filter for audio channels, with cutoff at %.1f Hz\n", cutoff_freq);
-    
-        /*
-        for(int i=0; i<FIR_HALF_SIZE; i++) {
-            printf("%.5f ", low_pass_fir[i]);
-        }
-        printf("\n");
-        */
-        
-        fm_mpx_status->audio_pos = fm_mpx_status->downsample_factor;
-        fm_mpx_status->audio_buffer = alloc_empty_buffer(fm_mpx_status->length * fm_mpx_status->channels);
-        if(fm_mpx_status->audio_buffer == NULL) return -1;
+
+        // The audio is read in fixed chunks of whole frames, independent of the block length, so
+        // the buffer held by each of a large number of stations stays small.
+        fm_mpx_status->audio_read_len = AUDIO_READ_FRAMES * fm_mpx_status->channels;
+        fm_mpx_status->audio_buffer = alloc_empty_buffer(fm_mpx_status->audio_read_len);
+        fm_mpx_status->audio_mono = alloc_empty_buffer(AUDIO_FILTER_TAPS - 1 + AUDIO_READ_FRAMES);
+        fm_mpx_status->audio_stereo = alloc_empty_buffer(AUDIO_FILTER_TAPS - 1 + AUDIO_READ_FRAMES);
+        if(fm_mpx_status->audio_buffer == NULL || fm_mpx_status->audio_mono == NULL ||
+                fm_mpx_status->audio_stereo == NULL) return -1;
+        fm_mpx_status->audio_index = 0;
+        fm_mpx_status->audio_len = 0;
+        fm_mpx_status->up_len = 0;
+        fm_mpx_status->resample_time = 0;
 
     } // end if(filename != NULL)
     else {
@@ -118,101 +146,229 @@ int fm_mpx_open(char *filename, size_t len, struct fm_mpx_struct* fm_mpx_status)
 }
 
 
-// samples provided by this function are in 0..10: they need to be divided by
-// 10 after.
-int fm_mpx_get_samples(float *mpx_buffer, struct rds_content_struct* rds_params, struct rds_signal_info* rds_signal, struct fm_mpx_struct * fm_mpx_status) {
-    get_rds_samples(mpx_buffer, fm_mpx_status->length, rds_params, rds_signal);
+// Changes the number of samples generated by each call to fm_mpx_get_samples.
+void fm_mpx_set_length(size_t len, struct fm_mpx_struct* fm_mpx_status) {
+    fm_mpx_status->length = len;
+}
 
-    if(fm_mpx_status->inf  == NULL) return 0; // if there is no audio, stop here
-    int i; 
-    for(i=0; i<fm_mpx_status->length; i++) {
-        if(fm_mpx_status->audio_pos >= fm_mpx_status->downsample_factor) {
-        	fm_mpx_status->audio_pos -= fm_mpx_status->downsample_factor;
-            
-            if(fm_mpx_status->audio_len == 0) {
-                int j;
-                for(j=0; j<2; j++) { // one retry
-                	fm_mpx_status->audio_len = sf_read_float(fm_mpx_status->inf, fm_mpx_status->audio_buffer, fm_mpx_status->length);
-                    if (fm_mpx_status->audio_len < 0) {
-                        fprintf(stderr, "Error reading audio\n");
-                        return -1;
-                    }
-                    if(fm_mpx_status->audio_len == 0) {
-                        if( sf_seek(fm_mpx_status->inf, 0, SEEK_SET) < 0 ) {
-                            fprintf(stderr, "Could not rewind in audio file, terminating\n");
-                            return -1;
-                        }
-                    } else {
-                        break;
-                    }
-                }
-                fm_mpx_status->audio_index = 0;
-            } else {
-            	fm_mpx_status->audio_index += fm_mpx_status->channels;
-            	fm_mpx_status->audio_len -= fm_mpx_status->channels;
+
+// Reads the next chunk of audio into the mono and stereo buffers, after the
+// samples still under the filter for the next output.
+static int fm_mpx_read_audio(struct fm_mpx_struct * fm_mpx_status) {
+    int first = fm_mpx_status->audio_index;
+    int kept = fm_mpx_status->audio_len - first;
+
+    memmove(fm_mpx_status->audio_mono, fm_mpx_status->audio_mono + first, kept * sizeof(float));
+    memmove(fm_mpx_status->audio_stereo, fm_mpx_status->audio_stereo + first, kept * sizeof(float));
+    fm_mpx_status->audio_index = 0;
+
+    int len = 0;
+    int j;
+    for(j=0; j<2; j++) { // one retry
+        len = sf_read_float(fm_mpx_status->inf, fm_mpx_status->audio_buffer, fm_mpx_status->audio_read_len);
+        if (len < 0) {
+            fprintf(stderr, "Error reading audio\n");
+            return -1;
+        }
+        if(len == 0) {
+            if( sf_seek(fm_mpx_status->inf, 0, SEEK_SET) < 0 ) {
+                fprintf(stderr, "Could not rewind in audio file, terminating\n");
+                return -1;
             }
+        } else {
+            break;
         }
+    }
+    if(len == 0) {
+        fprintf(stderr, "No audio in input file\n");
+        return -1;
+    }
 
-        
-        // First store the current sample(s) into the FIR filter's ring buffer
-        if(fm_mpx_status->channels == 0) {
-        	fm_mpx_status->fir_buffer_mono[fm_mpx_status->fir_index] = fm_mpx_status->audio_buffer[fm_mpx_status->audio_index];
-        } else {
-            // In stereo operation, generate sum and difference signals
-        	fm_mpx_status->fir_buffer_mono[fm_mpx_status->fir_index] =
-        			fm_mpx_status->audio_buffer[fm_mpx_status->audio_index] + fm_mpx_status->audio_buffer[fm_mpx_status->audio_index + 1];
-        	fm_mpx_status->fir_buffer_stereo[fm_mpx_status->fir_index] =
-        			fm_mpx_status->audio_buffer[fm_mpx_status->audio_index] - fm_mpx_status->audio_buffer[fm_mpx_status->audio_index + 1];
+    int frames = len / fm_mpx_status->channels;
+    const float *audio = fm_mpx_status->audio_buffer;
+    float *mono = fm_mpx_status->audio_mono + kept;
+    float *stereo = fm_mpx_status->audio_stereo + kept;
+    if(fm_mpx_status->channels == 1) {
+        // Doubled to match the level of the left plus right sum of a stereo file
+        for(j=0; j<frames; j++) {
+            mono[j] = 2 * audio[j];
+        }
+    } else {
+        // In stereo operation, generate sum and difference signals
+        for(j=0; j<frames; j++) {
+            mono[j] = audio[j * fm_mpx_status->channels] + audio[j * fm_mpx_status->channels + 1];
+            stereo[j] = audio[j * fm_mpx_status->channels] - audio[j * fm_mpx_status->channels + 1];
+        }
+    }
+    fm_mpx_status->audio_len = kept + frames;
+
+    return 0;
+}
+
+
+// Interpolates count audio samples by AUDIO_UPSAMPLE.  A row of taps lines up
+// with the outputs of one audio sample, so the inner loop fills a vector
+// register and no sums have to be gathered across it, and UPSAMPLE_GROUP
+// audio samples are worked on side by side to keep several sums in flight.
+static void fm_mpx_interpolate(const float * __restrict__ audio, float * __restrict__ up, int count,
+        const float * __restrict__ taps) {
+    int n, k, j, p;
+
+    for(n=0; n+UPSAMPLE_GROUP<=count; n+=UPSAMPLE_GROUP) {
+        float acc[UPSAMPLE_GROUP * AUDIO_UPSAMPLE] = { 0 };
+        for(k=0; k<AUDIO_FILTER_TAPS; k++) {
+            for(j=0; j<UPSAMPLE_GROUP; j++) {
+                for(p=0; p<AUDIO_UPSAMPLE; p++) {
+                    acc[j * AUDIO_UPSAMPLE + p] += taps[k * AUDIO_UPSAMPLE + p] * audio[n + j + k];
+                }
+            }
         }
-        fm_mpx_status->fir_index++;
-        if(fm_mpx_status->fir_index >= FIR_SIZE) fm_mpx_status->fir_index = 0;
-        
-        // Now apply the FIR low-pass filter
-        
-        /* As the FIR filter is symmetric, we do not multiply all 
-           the coefficients independently, but two-by-two, thus reducing
-           the total number of multiplications by a factor of two
-        */
-        float out_mono = 0;
-        float out_stereo = 0;
-        int ifbi = fm_mpx_status->fir_index;  // ifbi = increasing FIR Buffer Index
-        int dfbi = fm_mpx_status->fir_index;  // dfbi = decreasing FIR Buffer Index
-        int fi;
-        for(fi=0; fi<FIR_HALF_SIZE; fi++) {  // fi = Filter Index
-            dfbi--;
-            if(dfbi < 0) dfbi = FIR_SIZE-1;
-            out_mono += 
-            		fm_mpx_status->low_pass_fir[fi] *
-                    (fm_mpx_status->fir_buffer_mono[ifbi] + fm_mpx_status->fir_buffer_mono[dfbi]);
-            if(fm_mpx_status->channels > 1) {
-                out_stereo += 
-                		fm_mpx_status->low_pass_fir[fi] *
-                        (fm_mpx_status->fir_buffer_stereo[ifbi] + fm_mpx_status->fir_buffer_stereo[dfbi]);
+        memcpy(up + n * AUDIO_UPSAMPLE, acc, sizeof(acc));
+    }
+
+    for(; n<count; n++) {
+        float acc[AUDIO_UPSAMPLE] = { 0 };
+        for(k=0; k<AUDIO_FILTER_TAPS; k++) {
+            for(p=0; p<AUDIO_UPSAMPLE; p++) {
+                acc[p] += taps[k * AUDIO_UPSAMPLE + p] * audio[n + k];
             }
-            ifbi++;
-            if(ifbi >= FIR_SIZE) ifbi = 0;
         }
-        // End of FIR filter
-        
-        mpx_buffer[i] = 
-            mpx_buffer[i] +    // RDS data samples are currently in mpx_buffer
-            4.05*out_mono;     // Unmodulated monophonic (or stereo-sum) signal
+        memcpy(up + n * AUDIO_UPSAMPLE, acc, sizeof(acc));
+    }
+}
+
+
+// Upsamples the next UPSAMPLE_INPUTS audio samples into the upsampled
+// buffers, after the samples still needed by the cubic interpolator.
+static int fm_mpx_upsample(struct fm_mpx_struct * fm_mpx_status) {
+    int first = (int) fm_mpx_status->resample_time;
+    int kept = fm_mpx_status->up_len - first;
+
+    memmove(fm_mpx_status->up_mono, fm_mpx_status->up_mono + first, kept * sizeof(float));
+    memmove(fm_mpx_status->up_stereo, fm_mpx_status->up_stereo + first, kept * sizeof(float));
+    fm_mpx_status->resample_time -= first;
+    fm_mpx_status->up_len = kept;
+
+    int done = 0;
+    while(done < UPSAMPLE_INPUTS) {
+        int count = fm_mpx_status->audio_len - (AUDIO_FILTER_TAPS - 1) - fm_mpx_status->audio_index;
+        if(count <= 0) {
+            if(fm_mpx_read_audio(fm_mpx_status) < 0) return -1;
+            continue;
+        }
+        if(count > UPSAMPLE_INPUTS - done) count = UPSAMPLE_INPUTS - done;
+
+        fm_mpx_interpolate(fm_mpx_status->audio_mono + fm_mpx_status->audio_index,
+                fm_mpx_status->up_mono + fm_mpx_status->up_len, count, fm_mpx_status->upsample_taps);
+        if(fm_mpx_status->channels > 1) {
+            fm_mpx_interpolate(fm_mpx_status->audio_stereo + fm_mpx_status->audio_index,
+                    fm_mpx_status->up_stereo + fm_mpx_status->up_len, count, fm_mpx_status->upsample_taps);
+        }
+
+        fm_mpx_status->audio_index += count;
+        fm_mpx_status->up_len += count * AUDIO_UPSAMPLE;
+        done += count;
+    }
+
+    return 0;
+}
+
+
+// Resamples the upsampled audio to count samples of the multiplex.  Each
+// output is a cubic Lagrange interpolation between the two upsampled samples
+// either side of it, which the filter has left far enough below the
+// upsampled rate that the images of the interpolation are negligible.
+static int fm_mpx_resample(float *out_mono, float *out_stereo, size_t count, struct fm_mpx_struct * fm_mpx_status) {
+    size_t i = 0;
+
+    while(i < count) {
+        int first = (int) fm_mpx_status->resample_time;
+        if(first + CUBIC_POINTS > fm_mpx_status->up_len) {
+            if(fm_mpx_upsample(fm_mpx_status) < 0) return -1;
+            continue;
+        }
+
+        // Weights of the points at -1, 0, 1 and 2 for an output x past point 0
+        float x = fm_mpx_status->resample_time - first;
+        float xp1 = x + 1;
+        float xm1 = x - 1;
+        float xm2 = x - 2;
+        float w0 = -x * xm1 * xm2 * (1.f/6);
+        float w1 = xp1 * xm1 * xm2 * .5f;
+        float w2 = -xp1 * x * xm2 * .5f;
+        float w3 = xp1 * x * xm1 * (1.f/6);
+
+        const float *mono = fm_mpx_status->up_mono + first;
+        out_mono[i] = w0 * mono[0] + w1 * mono[1] + w2 * mono[2] + w3 * mono[3];
+        if(out_stereo != NULL) {
+            const float *stereo = fm_mpx_status->up_stereo + first;
+            out_stereo[i] = w0 * stereo[0] + w1 * stereo[1] + w2 * stereo[2] + w3 * stereo[3];
+        }
+
+        fm_mpx_status->resample_time += fm_mpx_status->resample_step;
+        i++;
+    }
+
+    return 0;
+}
 
+
+// Adds n samples of audio, pilot and stereo subcarrier to the RDS signal
+// already in mpx, with the carriers starting from their first sample.
+static inline void fm_mpx_add_audio(float * __restrict__ mpx, const float * __restrict__ out_mono,
+        const float * __restrict__ out_stereo, const double * __restrict__ pilot,
+        const double * __restrict__ subcarrier, size_t n) {
+    size_t j;
+    for(j=0; j<n; j++) {
+        mpx[j] =
+            mpx[j] +                // RDS data samples are currently in mpx_buffer
+            4.05*out_mono[j];       // Unmodulated monophonic (or stereo-sum) signal
+        mpx[j] += pilot[j];         // Stereo pilot tone
+    }
+    if(out_stereo != NULL) {
+        for(j=0; j<n; j++) {
+            mpx[j] += subcarrier[j] * out_stereo[j]; // Stereo difference signal
+        }
+    }
+}
+
+
+// samples provided by this function are in 0..10: they need to be divided by
+// 10 after.
+int fm_mpx_get_samples(float *mpx_buffer, struct rds_content_struct* rds_params, struct rds_signal_info* rds_signal, struct fm_mpx_struct * fm_mpx_status) {
+    get_rds_samples(mpx_buffer, fm_mpx_status->length, rds_params, rds_signal);
+
+    if(fm_mpx_status->inf  == NULL) return 0; // if there is no audio, stop here
+
+    float out_mono[MPX_CHUNK];
+    float out_stereo[MPX_CHUNK];
+    float *stereo = fm_mpx_status->channels > 1 ? out_stereo : NULL;
+    size_t first;
+
+    for(first=0; first<fm_mpx_status->length; first+=MPX_CHUNK) {
+        size_t count = fm_mpx_status->length - first;
+        if(count > MPX_CHUNK) count = MPX_CHUNK;
+
+        if(fm_mpx_resample(out_mono, stereo, count, fm_mpx_status) < 0) return -1;
+
+        // Add the audio and carriers a pilot period at a time, which keeps the
+        // carrier phases the same from one period to the next.
         // XXX: YLB Added the stereo pilot tone to all signals mono or stereo.
-        mpx_buffer[i] += .9*carrier_19[fm_mpx_status->phase_19];                  // Stereo pilot tone
-		fm_mpx_status->phase_19++;
-		if(fm_mpx_status->phase_19 >= 12) fm_mpx_status->phase_19 = 0;
-
-        if(fm_mpx_status->channels>1) {
-            mpx_buffer[i] += 4.05 * carrier_38[fm_mpx_status->phase_38] * out_stereo; // Stereo difference signal
-            fm_mpx_status->phase_38++;
-            if(fm_mpx_status->phase_38 >= 6) fm_mpx_status->phase_38 = 0;
+        const double *pilot = fm_mpx_status->pilot_19 + fm_mpx_status->phase_19;
+        const double *subcarrier = fm_mpx_status->subcarrier_38 + fm_mpx_status->phase_38;
+        float *mpx = mpx_buffer + first;
+        size_t i;
+        for(i=0; i+CARRIER_PERIOD<=count; i+=CARRIER_PERIOD) {
+            fm_mpx_add_audio(mpx + i, out_mono + i, stereo ? stereo + i : NULL, pilot, subcarrier, CARRIER_PERIOD);
+        }
+        fm_mpx_add_audio(mpx + i, out_mono + i, stereo ? stereo + i : NULL, pilot, subcarrier, count - i);
+
+        fm_mpx_status->phase_19 = (fm_mpx_status->phase_19 + count) % 12;
+        if(stereo) {
+            fm_mpx_status->phase_38 = (fm_mpx_status->phase_38 + count) % 6;
         }
-            
-        fm_mpx_status->audio_pos++;
-        
     }
-    
+
     return 0;
 }
 
@@ -223,6 +379,9 @@ int fm_mpx_close(struct fm_mpx_struct* fm_mpx_status) {
     }
     
     if(fm_mpx_status->audio_buffer != NULL) free(fm_mpx_status->audio_buffer);
+    if(fm_mpx_status->audio_mono != NULL) free(fm_mpx_status->audio_mono);
+    if(fm_mpx_status->audio_stereo != NULL) free(fm_mpx_status->audio_stereo);
+    if(fm_mpx_status->upsample_taps != NULL) free(fm_mpx_status->upsample_taps);
     
     return 0;
 }
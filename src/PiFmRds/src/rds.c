@@ -55,7 +55,11 @@ int get_rds_ct_group(uint16_t *blocks, struct rds_signal_info* rds_sig_info) {
     time_t now;
     struct tm *utc;
     
-    now = time (NULL);
+    if(rds_sig_info->use_sim_clock) {
+        now = rds_sig_info->sim_clock_start + (time_t) (rds_sig_info->sample_counter / RDS_SAMPLE_RATE);
+    } else {
+        now = time (NULL);
+    }
     utc = gmtime (&now);
 
     if(utc->tm_min != rds_sig_info->latest_minutes) {
@@ -130,15 +134,61 @@ void get_rds_group(int *buffer, struct rds_content_struct* rds_params, struct rd
     }
 }
 
-/* Get a number of RDS samples. This generates the envelope of the waveform using
-   pre-generated elementary waveform samples, and then it amplitude-modulates the 
-   envelope with a 57 kHz carrier, which is very efficient as 57 kHz is 4 times the
-   sample frequency we are working at (228 kHz).
+/* Computes samples start to start+count-1 of the bit period for the given pattern of
+   differentially encoded bits, of which only the newest 'bits' have been sent.  Sample t
+   is the envelope one sample earlier, as the samples have always been delivered, summed
+   from the oldest bit to the newest so that the result matches the overlap-add exactly.
+   It is then amplitude-modulated with a 57 kHz carrier, which is very efficient as
+   57 kHz is 4 times the sample frequency we are working at (228 kHz).
+ */
+static void get_rds_segment(float *buffer, int history, int bits, int start, int count) {
+    int t;
+    for(t=start; t<start+count; t++) {
+        float sample = 0;
+        if(t % 2 == 1) {
+            int k;
+            for(k=bits-1; k>=0; k--) {
+                float val = waveform_biphase[t - 1 + k*SAMPLES_PER_BIT];
+                if((history >> k) & 1) val = -val;
+                sample += val;
+            }
+            if(t % 4 == 3) sample = -sample;
+        }
+        *buffer++ = sample;
+    }
+}
+
+/* Resets the signal to the start of a group and builds the segment table
+ */
+void init_rds_signal(struct rds_signal_info * rds_signal) {
+    int i;
+    for(i=0; i<SEGMENT_PATTERNS; i++) {
+        get_rds_segment(rds_signal->segments[i], i, SEGMENT_BITS, 0, SAMPLES_PER_BIT);
+    }
+
+    rds_signal->bit_pos = BITS_PER_GROUP;
+    rds_signal->history = 0;
+    rds_signal->history_bits = 0;
+    rds_signal->prev_output = 0;
+    rds_signal->cur_output = 0;
+    rds_signal->cur_bit = 0;
+    rds_signal->sample_count = SAMPLES_PER_BIT;
+    rds_signal->latest_minutes = -1;
+    rds_signal->state = 0;
+    rds_signal->ps_state = 0;
+    rds_signal->rt_state = 0;
+    rds_signal->use_sim_clock = 0;
+    rds_signal->sim_clock_start = 0;
+    rds_signal->sample_counter = 0;
+}
+
+/* Get a number of RDS samples. Each sample is overlapped by the waveforms of the last
+   SEGMENT_BITS bits, so once that many have been sent a bit period is copied whole from
+   the table entry for their pattern.
  */
 void get_rds_samples(float *buffer, int count, struct rds_content_struct* rds_content, struct rds_signal_info * rds_signal) {
 
-	int i;
-    for(i=0; i<count; i++) {
+    while(count > 0) {
         if(rds_signal->sample_count >= SAMPLES_PER_BIT) {
             if(rds_signal->bit_pos >= BITS_PER_GROUP) {
                 get_rds_group(rds_signal->bit_buffer, rds_content, rds_signal);
@@ -149,48 +199,38 @@ void get_rds_samples(float *buffer, int count, struct rds_content_struct* rds_co
             rds_signal->cur_bit = rds_signal->bit_buffer[rds_signal->bit_pos];
             rds_signal->prev_output = rds_signal->cur_output;
             rds_signal->cur_output = rds_signal->prev_output ^ rds_signal->cur_bit;
-            
-            rds_signal->inverting = (rds_signal->cur_output == 1);
-
-            float *src = waveform_biphase;
-            int idx = rds_signal->in_sample_index;
-            int j;
-            for(j=0; j<FILTER_SIZE; j++) {
-                float val = (*src++);
-                if(rds_signal->inverting) val = -val;
-                rds_signal->sample_buffer[idx++] += val;
-                if(idx >= SAMPLE_BUFFER_SIZE) idx = 0;
-            }
 
-            rds_signal->in_sample_index += SAMPLES_PER_BIT;
-            if(rds_signal->in_sample_index >= SAMPLE_BUFFER_SIZE) rds_signal->in_sample_index -= SAMPLE_BUFFER_SIZE;
-            
+            rds_signal->history = ((rds_signal->history << 1) | rds_signal->cur_output) & (SEGMENT_PATTERNS - 1);
+            if(rds_signal->history_bits < SEGMENT_BITS) rds_signal->history_bits++;
+
             rds_signal->bit_pos++;
             rds_signal->sample_count = 0;
         }
-        
-        float sample = rds_signal->sample_buffer[rds_signal->out_sample_index];
-        rds_signal->sample_buffer[rds_signal->out_sample_index] = 0;
-        rds_signal->out_sample_index++;
-        if(rds_signal->out_sample_index >= SAMPLE_BUFFER_SIZE) rds_signal->out_sample_index = 0;
-        
-        
-        // modulate at 57 kHz
-        // use phase for this
-        switch(rds_signal->phase) {
-            case 0:
-            case 2: sample = 0; break;
-            case 1: break;
-            case 3: sample = -sample; break;
+
+        int n = SAMPLES_PER_BIT - rds_signal->sample_count;
+        if(n > count) n = count;
+
+        if(rds_signal->history_bits == SEGMENT_BITS) {
+            memcpy(buffer, &rds_signal->segments[rds_signal->history][rds_signal->sample_count], n * sizeof(float));
+        } else {
+            get_rds_segment(buffer, rds_signal->history, rds_signal->history_bits, rds_signal->sample_count, n);
         }
-        rds_signal->phase++;
-        if(rds_signal->phase >= 4) rds_signal->phase = 0;
-        
-        *buffer++ = sample;
-        rds_signal->sample_count++;
+
+        buffer += n;
+        count -= n;
+        rds_signal->sample_count += n;
+        rds_signal->sample_counter += n;
     }
 }
 
+/* Switches the CT group between the wall clock and a clock derived from the number of
+   samples generated.  The simulated clock continues on from the current time.
+*/
+void set_rds_sim_clock(int use_sim_clock, struct rds_signal_info * rds_signal) {
+    rds_signal->use_sim_clock = use_sim_clock;
+    rds_signal->sim_clock_start = time(NULL) - (time_t) (rds_signal->sample_counter / RDS_SAMPLE_RATE);
+}
+
 void set_rds_rt(char *rt, struct rds_content_struct* rds_params) {
     strncpy(rds_params->rt, rt, 64);
     int i;
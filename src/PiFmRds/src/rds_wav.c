@@ -49,16 +49,7 @@ int main(int argc, char **argv) {
 
     fm_mpx_status_struct.phase_38 = 0;
     fm_mpx_status_struct.phase_19 = 0;
-    fm_mpx_status_struct.audio_index = 0;
     fm_mpx_status_struct.audio_len = 0;
-    fm_mpx_status_struct.fir_index = 0;
-
-
-    unsigned int i;
-    for (i = 0; i < FIR_SIZE; i++) {
-        fm_mpx_status_struct.fir_buffer_mono[i] = 0;
-        fm_mpx_status_struct.fir_buffer_stereo[i] = 0;
-    }
 
 
     rds_status_struct.pi = 0x1234;
@@ -0,0 +1,349 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * RingDataQueue.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "RingDataQueue.h"
+#include "DigitizerSimLogger.h"
+#include <algorithm>
+
+// Check the clock once every this many spins
+#define SPINS_PER_CLOCK_CHECK 64
+
+/**
+ * Tells the core that this thread is spinning
+ */
+static inline void cpuRelax() {
+#if defined(__i386__) || defined(__x86_64__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__)
+	__asm__ __volatile__("yield");
+#endif
+}
+
+RingDataQueue::RingDataQueue(unsigned short maxQueueDepth, CallbackInterface *userClass, unsigned int spinMicroseconds) :
+	UserDataQueue(maxQueueDepth, userClass),
+	slots(2 * maxQueueDepth + 1)
+{
+	TRACE("Entering Method");
+	spinNanoseconds = spinMicroseconds * 1000ULL;
+
+	// Spinning only helps when the other side is running on another core
+	if (boost::thread::hardware_concurrency() < 2) {
+		INFO("Single core, the queue will not spin");
+		spinNanoseconds = 0;
+	}
+	shuttingDown.store(false);
+	policy.store(DROP_OLDEST);
+	depth.store(maxQueueDepth);
+	flushIndex.store(0);
+	writeIndex.store(0);
+	readIndex.store(0);
+	consumerParked.store(false);
+	producerParked.store(false);
+	TRACE("Leaving Method");
+}
+
+RingDataQueue::~RingDataQueue() {
+	TRACE("Entering Method");
+	shutDown();
+	TRACE("Leaving Method");
+}
+
+void RingDataQueue::_waitForData() {
+	TRACE("Entering Method");
+	unsigned long long read = readIndex.load(MEMORY_ORDER_RELAXED);
+
+	while (not shuttingDown.load()) {
+		if (not waitForBlock(read)) {
+			TRACE("Shutting down, ignoring data");
+			break;
+		}
+
+		// Take the block out of its slot so the buffer is recycled once the user is done with it
+		QueuedBlock block;
+		QueuedBlock &slot = slots[read % slots.size()];
+		block.buffer.swap(slot.buffer);
+		block.metadata = slot.metadata;
+		block.enqueueTime = slot.enqueueTime;
+		bool flushed = (read < flushIndex.load(MEMORY_ORDER_ACQUIRE));
+
+		++read;
+		readIndex.store(read);
+		wakeProducer();
+
+		if (flushed) {
+			TRACE("Discarding a flushed block");
+			recordGap(block);
+			continue;
+		}
+
+		deliverToUser(block);
+	}
+
+	TRACE("Leaving Method");
+}
+
+/**
+ * Waits until the block at read has been written.  Returns false if the queue is shutting down.
+ */
+bool RingDataQueue::waitForBlock(unsigned long long read) {
+	if (writeIndex.load(MEMORY_ORDER_ACQUIRE) != read) {
+		return true;
+	}
+
+	if (spinNanoseconds > 0) {
+		unsigned long long deadline = now() + spinNanoseconds;
+		for (unsigned int i = 1; ; ++i) {
+			if (writeIndex.load(MEMORY_ORDER_ACQUIRE) != read) {
+				return true;
+			}
+			if (shuttingDown.load(MEMORY_ORDER_RELAXED)) {
+				return false;
+			}
+			if (i % SPINS_PER_CLOCK_CHECK == 0 && now() >= deadline) {
+				break;
+			}
+			cpuRelax();
+		}
+	}
+
+	// The producer reads consumerParked after publishing a block, and we read writeIndex
+	// after setting it, so one of us sees the other and the wake up is not lost
+	boost::unique_lock<boost::mutex> lock(parkMutex);
+	consumerParked.store(true);
+	while (writeIndex.load() == read && not shuttingDown.load()) {
+		TRACE("Waiting until Data is available");
+		increment(consumerWaits);
+		dataAvailable.wait(lock);
+	}
+	consumerParked.store(false);
+
+	return not shuttingDown.load();
+}
+
+/**
+ * Waits while blocking until the user has taken enough blocks for the one at write to fit
+ * within the queue depth.
+ */
+void RingDataQueue::waitForSpace(unsigned long long write) {
+	if (write - readIndex.load(MEMORY_ORDER_ACQUIRE) < depth.load()) {
+		return;
+	}
+
+	if (spinNanoseconds > 0) {
+		unsigned long long deadline = now() + spinNanoseconds;
+		for (unsigned int i = 1; ; ++i) {
+			if (write - readIndex.load(MEMORY_ORDER_ACQUIRE) < depth.load(MEMORY_ORDER_RELAXED)
+					|| policy.load(MEMORY_ORDER_RELAXED) != BLOCK_PRODUCER
+					|| shuttingDown.load(MEMORY_ORDER_RELAXED)) {
+				return;
+			}
+			if (i % SPINS_PER_CLOCK_CHECK == 0 && now() >= deadline) {
+				break;
+			}
+			cpuRelax();
+		}
+	}
+
+	boost::unique_lock<boost::mutex> lock(parkMutex);
+	producerParked.store(true);
+	while (write - readIndex.load() >= depth.load() && policy.load() == BLOCK_PRODUCER && not shuttingDown.load()) {
+		TRACE("Waiting for the user to service the queue");
+		spaceAvailable.wait(lock);
+	}
+	producerParked.store(false);
+}
+
+void RingDataQueue::wakeConsumer() {
+	if (consumerParked.load()) {
+		boost::lock_guard<boost::mutex> lock(parkMutex);
+		dataAvailable.notify_one();
+	}
+}
+
+void RingDataQueue::wakeProducer() {
+	if (producerParked.load()) {
+		boost::lock_guard<boost::mutex> lock(parkMutex);
+		spaceAvailable.notify_one();
+	}
+}
+
+void RingDataQueue::deliverData(const SampleBufferPool::Buffer &buffer, const BlockMetadata &metadata)
+{
+	TRACE("Entering Method");
+	QueuedBlock block;
+	block.buffer = buffer;
+	block.metadata = metadata;
+	block.enqueueTime = now();
+	unsigned long long write = writeIndex.load(MEMORY_ORDER_RELAXED);
+	OverflowPolicy currentPolicy = policy.load();
+
+	if (currentPolicy == BLOCK_PRODUCER && depth.load() > 0) {
+		waitForSpace(write);
+	}
+
+	if (shuttingDown.load()) {
+		INFO("Shutting down, refusing to pass data to user.");
+		return;
+	}
+
+	unsigned int currentDepth = depth.load();
+	if (currentDepth == 0) {
+		ERROR("Queue Size has been set to zero.  You will not receive any data");
+	}
+
+	bool dropsOldest = (currentPolicy == DROP_OLDEST || currentPolicy == COALESCE);
+
+	// A block held back for coalescing goes ahead of the new one
+	if (pending.buffer) {
+		if (not hasRoom(write, currentDepth) && currentPolicy == COALESCE && canCoalesce(pending, block, currentDepth)) {
+			WARN("Queue full, appending block at sample " << metadata.sampleIndex << " to the one before it");
+			coalesce(pending, block);
+			return;
+		}
+
+		if (not hasRoom(write, currentDepth) && dropsOldest) {
+			dropOldest(write);
+		}
+
+		if (hasRoom(write, currentDepth)) {
+			publish(pending, write);
+		} else {
+			ERROR("Queue full!  Dropping the held back block at sample " << pending.metadata.sampleIndex);
+			recordGap(pending);
+		}
+		pending.buffer.reset();
+	}
+
+	if (not hasRoom(write, currentDepth)) {
+		if (currentPolicy == COALESCE) {
+			TRACE("Queue full, holding back the block at sample " << metadata.sampleIndex);
+			pending = block;
+			return;
+		} else if (currentPolicy == DROP_OLDEST) {
+			dropOldest(write);
+		} else if (currentPolicy == FLUSH_QUEUE) {
+			// The delivery thread records the gaps of the flushed blocks as it discards them,
+			// the new block is dropped with them as in the locking queue.
+			ERROR("Queue flushing!  Data was not serviced fast enough.");
+			flushIndex.store(write, MEMORY_ORDER_RELEASE);
+			recordGap(block);
+			return;
+		}
+	}
+
+	if (not hasRoom(write, currentDepth)) {
+		ERROR("Queue full!  Dropping the new block at sample " << metadata.sampleIndex);
+		recordGap(block);
+		return;
+	}
+
+	publish(block, write);
+	recordLatency(enqueueLatency, now() - block.enqueueTime);
+	TRACE("Leaving Method");
+}
+
+/**
+ * True if a block written at write would leave no more than depth blocks for the user and fit
+ * in the ring.  Flushed blocks still take up their slots until the delivery thread discards them.
+ */
+bool RingDataQueue::hasRoom(unsigned long long write, unsigned int depth) {
+	unsigned long long read = readIndex.load(MEMORY_ORDER_ACQUIRE);
+	unsigned long long oldest = std::max(read, flushIndex.load(MEMORY_ORDER_RELAXED));
+	return write - oldest < depth && write - read < slots.size();
+}
+
+/**
+ * Marks the oldest block the user has not yet taken as flushed.  The delivery thread records
+ * the gap when it discards it, so a block it took just before is not counted as dropped.
+ */
+void RingDataQueue::dropOldest(unsigned long long write) {
+	unsigned long long oldest = std::max(readIndex.load(MEMORY_ORDER_ACQUIRE), flushIndex.load(MEMORY_ORDER_RELAXED));
+	if (oldest < write) {
+		ERROR("Queue full!  Dropping the oldest block at sample " << slots[oldest % slots.size()].metadata.sampleIndex);
+		flushIndex.store(oldest + 1, MEMORY_ORDER_RELEASE);
+	}
+}
+
+/**
+ * Writes block at write, which must have room, and hands it to the delivery thread.
+ */
+void RingDataQueue::publish(const QueuedBlock &block, unsigned long long &write) {
+	// The slot was emptied by the delivery thread before it moved readIndex past it
+	TRACE("Adding array of size: " << block.buffer->size() << " to UserDataQueue buffer");
+	slots[write % slots.size()] = block;
+	++write;
+	writeIndex.store(write);
+	wakeConsumer();
+}
+
+/**
+ * Every slot of the ring may hold a block, whether queued or flushed but not yet discarded,
+ * as well as the block held back for coalescing.
+ */
+size_t RingDataQueue::maxBlocksHeld() {
+	return slots.size() + 1;
+}
+
+void RingDataQueue::shutDown() {
+	TRACE("Entering Method");
+	shuttingDown.store(true);
+	{
+		boost::lock_guard<boost::mutex> lock(parkMutex);
+		dataAvailable.notify_all();
+		spaceAvailable.notify_all();
+	}
+	UserDataQueue::shutDown();
+	TRACE("Leaving Method");
+}
+
+void RingDataQueue::setMaxQueueSize(unsigned short size) {
+	TRACE("Entering Method");
+	UserDataQueue::setMaxQueueSize(size);
+
+	unsigned int capacity = (slots.size() - 1) / 2;
+	if (size > capacity) {
+		WARN("The queue holds at most " << capacity << " blocks until the simulator is restarted");
+		size = capacity;
+	}
+	depth.store(size);
+
+	{
+		boost::lock_guard<boost::mutex> lock(parkMutex);
+		spaceAvailable.notify_all();
+	}
+	TRACE("Leaving Method");
+}
+
+void RingDataQueue::setOverflowPolicy(OverflowPolicy policy) {
+	TRACE("Entering Method");
+	UserDataQueue::setOverflowPolicy(policy);
+	this->policy.store(policy);
+
+	{
+		boost::lock_guard<boost::mutex> lock(parkMutex);
+		spaceAvailable.notify_all();
+	}
+	TRACE("Leaving Method");
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * SampleBufferPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "SampleBufferPool.h"
+#include "DigitizerSimLogger.h"
+
+SampleBufferPool::SampleBufferPool() {
+	TRACE("Entering Method");
+	TRACE("Leaving Method");
+}
+
+SampleBufferPool::~SampleBufferPool() {
+	TRACE("Entering Method");
+	TRACE("Leaving Method");
+}
+
+SampleBufferPool::Buffer SampleBufferPool::acquire(size_t size) {
+	// A buffer is free once the pool holds its only reference.  Only this thread adds
+	// references so a free buffer cannot be taken from under us.
+	for (size_t i = 0; i < buffers.size(); ++i) {
+		if (buffers[i].unique() && buffers[i]->size() == size) {
+			return buffers[i];
+		}
+	}
+
+	// Blocks following a sample rate change, or the odd block that is a sample longer
+	for (size_t i = 0; i < buffers.size(); ++i) {
+		if (buffers[i].unique()) {
+			TRACE("Resizing a pooled buffer from " << buffers[i]->size() << " to " << size << " samples");
+			buffers[i]->resize(size);
+			return buffers[i];
+		}
+	}
+
+	TRACE("No free buffers, adding buffer " << buffers.size() + 1 << " of " << size << " samples to the pool");
+	buffers.push_back(Buffer(new Samples(size)));
+	return buffers.back();
+}
+
+void SampleBufferPool::reserve(size_t numBuffers, size_t size) {
+	TRACE("Entering Method");
+	size_t sized = 0;
+	for (size_t i = 0; i < buffers.size(); ++i) {
+		if (buffers[i]->size() == size) {
+			++sized;
+		}
+	}
+
+	for (size_t i = 0; i < buffers.size() && sized < numBuffers; ++i) {
+		if (buffers[i].unique() && buffers[i]->size() != size) {
+			buffers[i]->resize(size);
+			++sized;
+		}
+	}
+
+	for (; sized < numBuffers; ++sized) {
+		buffers.push_back(Buffer(new Samples(size)));
+	}
+	TRACE("Pool holds " << buffers.size() << " buffers");
+	TRACE("Leaving Method");
+}
+
+size_t SampleBufferPool::numBuffers() {
+	return buffers.size();
+}
@@ -33,101 +33,73 @@
 // sensitivity = (2 * pi * max_deviation) / samp_rate
 
 Transmitter::Transmitter() :
-		fm((2 * M_PI * MAX_FREQUENCY_DEVIATION) / BASE_SAMPLE_RATE),
-		tuner(basebandCmplxUpSampled, basebandCmplxUpSampledTuned, 0),
 		centerFrequency(-1),
+		tunedFrequency(0.0),
+		filePath(""),
 		rdsFullText("REDHAWK Radio, Rock the Hawk!"), rdsShortText("REDHAWK!"), rdsCallSign("WSDR"),
-		initialized(false),
 		numSamples(-1),
-		filePath(""),
-		tunedFrequency(0.0)
+		interpolator(NULL),
+		initialized(false),
+		active(false),
+		buffersAllocated(false),
+		synthesized(false),
+		fm((2 * M_PI * MAX_FREQUENCY_DEVIATION) / BASE_SAMPLE_RATE),
+		// The tuner only ever accumulates into the composite so its own output is never written
+		tuner(basebandCmplxUpSampled, basebandCmplxUpSampled, 0),
+		retunePending(false),
+		pendingNormFc(0.0)
 		{
 
 	TRACE("Entered Method");
 
 	fm_mpx_status_struct.phase_38 = 0;
 	fm_mpx_status_struct.phase_19 = 0;
-	fm_mpx_status_struct.audio_index = 0;
 	fm_mpx_status_struct.audio_len = 0;
-	fm_mpx_status_struct.fir_index = 0;
-
-	TRACE("Clearing out the fm_mpx structs");
-	unsigned int i;
-	for (i = 0; i < FIR_SIZE; i++) {
-		fm_mpx_status_struct.fir_buffer_mono[i] = 0;
-		fm_mpx_status_struct.fir_buffer_stereo[i] = 0;
-	}
+	fm_mpx_status_struct.inf = NULL;
 
 	/**
-	 * This is a bit of a messy approach currently and should be rolled into the Redhawk DSP library.
 	 * Initially, we inserted zeros to upsample then filtered the upsampled data.  This was a big strain on CPU.
 	 * The approach outlined in section 3.4 of http://www.dspguru.com/dsp/faqs/multirate/interpolation provides
-	 * a polyphase filter approach.  This allows us to create an LPF with 30 taps, then based on that, create ten 3 tap filters.
-	 * The data is then filtered by each of the 3 tap filters and combined to form the upsampled version.
-	 *
-	 * This is more efficient since we are filtering the data at the original sample rate 10 times with our 3 tap filters
-	 * instead of the upsampled rate (10x) once with our 30 tap filter.
+	 * a polyphase filter approach.  This allows us to create an LPF with 30 taps, then based on that, filter the
+	 * data at the original sample rate with ten 3 tap phases which together form the upsampled version.
 	 */
-	TRACE("Generating the temporary filter for the sole purpose of stealing the tap values");
-	FIRFilter tmpFilter(basebandCmplx, basebandCmplxUpSampled, FIRFilter::lowpass, Real(FILTER_ATTENUATION), Real(FILTER_CUTOFF));
+	RealArray filterTaps = getInterpolationFilter();
 
-	// This will have 30 filter taps.
-	RealArray filterTaps = tmpFilter.getFilterCoefficients();
-
-	polyphaseFilterTaps.resize(10);
-	polyphaseFilters.resize(10, NULL);
-
-	TRACE("Parsing tmpFilter taps and creating the 10 polyPhase filters");
-	for (int i = 0; i < 10; ++i) {
-
-		std::vector<float> tmpTaps;
-		tmpTaps.resize(3);
-		for (int ii = 0; ii < 3; ++ii) {
-			tmpTaps[ii] = filterTaps[i+ii*10];
-		}
-
-		polyphaseFilterTaps[i].resize(tmpTaps.size());
-		polyphaseFilterTaps[i] = tmpTaps;
-		polyphaseFilters[i] = new FIRFilter(basebandCmplx, basebandCmplx_polyPhaseout, &polyphaseFilterTaps[i][0], tmpTaps.size());
-
-	}
+	TRACE("Creating the polyphase interpolator");
+	interpolator = new PolyphaseInterpolator(basebandCmplx, basebandCmplxUpSampled, INTERPOLATION_FACTOR, filterTaps);
 
 	TRACE("Initialzing the RTL signal struct");
 	// Initialize the rds_signal info
-	rds_sig_info.bit_pos = BITS_PER_GROUP;
+	init_rds_signal(&rds_sig_info);
 
-	for (i = 0; i < SAMPLE_BUFFER_SIZE; ++i) {
-		rds_sig_info.sample_buffer[i] = 0;
-	}
+	TRACE("Exiting Method");
+}
 
-	rds_sig_info.prev_output = 0;
-	rds_sig_info.cur_output = 0;
-	rds_sig_info.cur_bit = 0;
-	rds_sig_info.sample_count = SAMPLES_PER_BIT;
-	rds_sig_info.inverting = 0;
-	rds_sig_info.phase = 0;
-	rds_sig_info.in_sample_index = 0;
-	rds_sig_info.out_sample_index = SAMPLE_BUFFER_SIZE-1;
-	rds_sig_info.latest_minutes = -1;
-	rds_sig_info.state = 0;
-	rds_sig_info.ps_state = 0;
-	rds_sig_info.rt_state = 0;
+/**
+ * The low pass filter, at the upsampled rate, used to interpolate the modulated signal.
+ */
+RealArray Transmitter::getInterpolationFilter() {
+	TRACE("Generating the temporary filter for the sole purpose of stealing the tap values");
+	ComplexArray tmpIn, tmpOut;
+	FIRFilter tmpFilter(tmpIn, tmpOut, FIRFilter::lowpass, Real(FILTER_ATTENUATION), Real(FILTER_CUTOFF));
 
-	TRACE("Exiting Method");
+	// This will have 30 filter taps.
+	return tmpFilter.getFilterCoefficients();
 }
 
 Transmitter::~Transmitter() {
 	TRACE("Entered Method");
 
-	TRACE("Deleting polyphase filters");
-	// Wait for the thread to join up
-	for (int i = 0; i < polyphaseFilters.size(); ++i) {
-		if (polyphaseFilters[i]) {
-			delete (polyphaseFilters[i]);
-		}
+	TRACE("Deleting polyphase interpolator");
+	if (interpolator) {
+		delete (interpolator);
+		interpolator = NULL;
+	}
+
+	TRACE("Closing the fm mpx file");
+	if (fm_mpx_status_struct.inf) {
+		fm_mpx_close(&fm_mpx_status_struct);
 	}
-	TRACE("Joining up the Transmitter thread");
-	m_Thread.join();
 	TRACE("Exiting Method");
 }
 
@@ -136,16 +108,17 @@ void Transmitter::setTunedFrequency(float tunedFrequency) {
 	TRACE("Entered Method");
 	TRACE("Setting Tuned Frequency to : " << tunedFrequency);
 	TRACE("Song is setup with a center frequency of: " << centerFrequency << " and sample rate of " << MAX_OUTPUT_SAMPLE_RATE);
-	this->tunedFrequency = tunedFrequency;
 
-	float normFc = (this->tunedFrequency - centerFrequency) / MAX_OUTPUT_SAMPLE_RATE;
+	float normFc = (tunedFrequency - centerFrequency) / MAX_OUTPUT_SAMPLE_RATE;
 
 
 
 	{
 		boost::mutex::scoped_lock lock(tunerMutex);
 		TRACE("Therefore this is a normFc of : " << normFc);
-		tuner.retune(normFc);
+		this->tunedFrequency = tunedFrequency;
+		pendingNormFc = normFc;
+		retunePending = true;
 	}
 
 	TRACE("Exited Method");
@@ -189,6 +162,13 @@ void Transmitter::setRdsCallSign(std::string rdsCallSign) {
 	TRACE("Exited Method");
 }
 
+void Transmitter::setSimulatedClock(bool useSimulatedClock) {
+	TRACE("Entered Method");
+	TRACE("Setting RDS simulated clock to: " << useSimulatedClock);
+	set_rds_sim_clock(useSimulatedClock ? 1 : 0, &rds_sig_info);
+	TRACE("Exited Method");
+}
+
 void Transmitter::setProgramType(uint16_t pty) {
 	TRACE("Entered Method");
 	if (pty >= 32) {
@@ -200,27 +180,6 @@ void Transmitter::setProgramType(uint16_t pty) {
 	TRACE("Exited Method");
 }
 
-void Transmitter::start() {
-	TRACE("Entered Method");
-
-	if (not initialized) {
-		ERROR("Transmitter asked to start but has not been initialized!  Request ignored.");
-	} else {
-		TRACE("Starting boost thread");
-		m_Thread = boost::thread(&Transmitter::doWork, this);
-	}
-
-	TRACE("Exited Method");
-}
-
-
-void Transmitter::join() {
-	TRACE("Entered Method");
-	TRACE("joining thread");
-	this->m_Thread.join();
-	TRACE("Exited Method");
-}
-
 int Transmitter::init(float centerFrequency, int numSamples) {
 	TRACE("Entered Method");
 	this->numSamples = numSamples;
@@ -259,17 +218,59 @@ int Transmitter::init(float centerFrequency, int numSamples) {
         return -1;
     }
 
+    setBlockSize(numSamples);
+    initialized = true;
+	TRACE("Exited Method");
+    return 0;
+}
+
+/**
+ * Changes the number of samples, at the base sample rate, generated by each call to generate().
+ * The data mixed by mix() will be ten times this size.  Must not be called while a block
+ * is being generated.
+ */
+void Transmitter::setBlockSize(int numSamples) {
+	TRACE("Entered Method");
+	this->numSamples = numSamples;
+	fm_mpx_set_length(numSamples, &fm_mpx_status_struct);
+
+	// Buffers are only held while the transmitter is active, otherwise they are sized when it next becomes active.
+	if (buffersAllocated) {
+		allocateBuffers();
+	}
+	TRACE("Exited Method");
+}
+
+void Transmitter::allocateBuffers() {
+	TRACE("Entered Method");
     TRACE("Clearing MPX and output vector buffer and resizing for " << numSamples << " samples");
     mpx_buffer.resize(numSamples, 0);
 
     basebandCmplx.resize(numSamples, std::complex<float>(0.0,0.0));
-    basebandCmplx_polyPhaseout.resize(numSamples, std::complex<float>(0.0,0.0));
 
-    basebandCmplxUpSampled.resize(numSamples*10, std::complex<float>(0.0,0.0));
-    basebandCmplxUpSampledTuned.resize(numSamples*10, std::complex<float>(0.0,0.0));
-    initialized = true;
+    // A synthesized transmitter is never upsampled or tuned itself
+    size_t upSampledSize = synthesized ? 0 : numSamples*INTERPOLATION_FACTOR;
+    basebandCmplxUpSampled.resize(upSampledSize, std::complex<float>(0.0,0.0));
+    buffersAllocated = true;
+	TRACE("Exited Method");
+}
+
+/**
+ * Frees the DSP buffers of a transmitter that has left the visible band.  They are reallocated
+ * by beginBlock when it becomes visible again.
+ */
+void Transmitter::releaseBuffers() {
+	TRACE("Entered Method");
+	active = false;
+
+	if (buffersAllocated) {
+		TRACE("Releasing the DSP buffers of " << filePath.string());
+		mpx_buffer.resize(0);
+		basebandCmplx.resize(0);
+		basebandCmplxUpSampled.resize(0);
+		buffersAllocated = false;
+	}
 	TRACE("Exited Method");
-    return 0;
 }
 
 
@@ -281,59 +282,155 @@ int Transmitter::init(float centerFrequency, int numSamples) {
  * 2. FM Modulate using the GNURadio implementation of FM modulation.
  * 3. Upsample to a higher sample rate so we can have higher bandwidth using the method from http://www.dspguru.com/dsp/faqs/multirate/interpolation
  * 4. Frequency shift up to he appropriate location based on our current tuned frequency and the location of our station.
+ *
+ * beginBlock() decides whether the station is visible for this block, steps 1-3 are then done by generate() and step 4
+ * by mix(), which adds the shifted samples straight into the composite.  The mixing may be split into sample ranges
+ * which are run concurrently, once all ranges are complete finishBlock() must be called.
+ *
+ * Tunes to blockTunedFrequency and marks the transmitter active if any part of its spectrum falls within
+ * halfBandwidth of it.  Inactive transmitters are not generated, tuned or mixed for this block.  Must be
+ * called once per block before generate().
  */
-int Transmitter::doWork() {
+bool Transmitter::beginBlock(float blockTunedFrequency, float halfBandwidth) {
 	TRACE("Entered Method");
 
-	// Only do work if our frequency is within the bandwidth of the tuner.
+	if (not initialized) {
+		ERROR("Transmitter asked to do work but has not been initialized!  Request ignored.");
+		active = false;
+		return false;
+	}
+
+	if (blockTunedFrequency != tunedFrequency) {
+		setTunedFrequency(blockTunedFrequency);
+	}
+
+	{
+		// Retunes are only applied on block boundaries so every range of a block is shifted identically.
+		boost::mutex::scoped_lock lock(tunerMutex);
+		if (retunePending) {
+			tuner.retune(pendingNormFc);
+			channel.shift = -pendingNormFc;
+			retunePending = false;
+		}
+	}
+
+	float offset = fabs(centerFrequency - blockTunedFrequency);
+
+	// Only do work if our frequency is within the bandwidth of the tuner and our spectrum overlaps the requested band.
 	TRACE("Checking if there is any reason to do work.");
-	if (abs(centerFrequency - tunedFrequency) > 0.5 * MAX_OUTPUT_SAMPLE_RATE) {
-		TRACE("Transmitter is not in tuned range.  Returning all zeros.");
-		basebandCmplxUpSampledTuned.resize(numSamples*10, std::complex<float>(0.0,0.0));
+	active = (offset <= 0.5 * MAX_OUTPUT_SAMPLE_RATE) && (offset - TRANSMITTER_HALF_BANDWIDTH < halfBandwidth);
+
+	if (not active) {
+		TRACE("Transmitter is not in tuned range.");
+	} else if (not buffersAllocated) {
+		allocateBuffers();
+	}
+
+	TRACE("Exited Method");
+	return active;
+}
+
+/**
+ * Marks the transmitter inactive until the next call to beginBlock.
+ */
+void Transmitter::deactivate() {
+	active = false;
+}
+
+int Transmitter::generate() {
+	TRACE("Entered Method");
+
+	if (not active) {
+		TRACE("Transmitter is not active for this block.  Nothing to do.");
 		return 0;
-	} else {
+	}
 
-		TRACE("Receiving samples from fm_mpx_get_samples() for file: ");
-		if( fm_mpx_get_samples(&mpx_buffer[0], &rds_content, &rds_sig_info, &fm_mpx_status_struct) < 0 ) {
-			ERROR("Error occurred adding RDS data to sound file.");
-			return -1;
-		}
+	TRACE("Receiving samples from fm_mpx_get_samples() for file: ");
+	if( fm_mpx_get_samples(&mpx_buffer[0], &rds_content, &rds_sig_info, &fm_mpx_status_struct) < 0 ) {
+		ERROR("Error occurred adding RDS data to sound file.");
+		active = false;
+		return -1;
+	}
 
 
-		TRACE("Scaling samples");
-		mpx_buffer /= 10.;
+	TRACE("Scaling samples");
+	mpx_buffer /= 10.;
 
-		TRACE("FM Modulating the real data");
-		fm.modulate(mpx_buffer, basebandCmplx);
+	TRACE("FM Modulating the real data");
+	fm.modulate(mpx_buffer, basebandCmplx);
 
+	if (synthesized) {
+		TRACE("Leaving the upsampling and tuning to the synthesizer");
+		channel.input = &basebandCmplx[0];
+	} else {
 		TRACE("Polyphase filtering for upsampling");
-		for (int i = 0; i < 10; ++i) {
-			polyphaseFilters[i]->run();
-			for (int ii = 0; ii < basebandCmplx_polyPhaseout.size(); ++ii) {
-				basebandCmplxUpSampled[i + 10*ii] = basebandCmplx_polyPhaseout[ii];
-			}
-		}
+		interpolator->run();
+	}
 
+	active = true;
 
-		{
-			boost::mutex::scoped_lock lock(tunerMutex);
-			TRACE("Tuning to the relative frequency");
-			tuner.run();
-		}
+	TRACE("Exited Method");
+	return 0;
+}
 
-		TRACE("Exited Method");
-		return 0;
+/**
+ * Shifts samples first to first + count of the upsampled block to the relative frequency and adds them to out,
+ * which points at the composite's sample first.
+ */
+void Transmitter::mix(size_t first, size_t count, std::complex<float> *out) {
+	TRACE("Mixing samples " << first << " to " << first + count << " at the relative frequency");
+	tuner.accumulate(first, count, out);
+}
+
+void Transmitter::finishBlock() {
+	TRACE("Entered Method");
+	if (active && not synthesized) {
+		tuner.advance(basebandCmplxUpSampled.size());
 	}
+	TRACE("Exited Method");
 }
 
+bool Transmitter::isActive() {
+	return active;
+}
 
-std::valarray< std::complex<float> >& Transmitter::getData() {
+size_t Transmitter::getBlockSize() {
+	return basebandCmplxUpSampled.size();
+}
+
+/**
+ * Chooses whether the transmitter upsamples and tunes its own output or leaves that to an FftSynthesizer,
+ * which reads the base rate samples through getChannel().  Must not be called while a block is being generated.
+ */
+void Transmitter::setSynthesized(bool synthesized) {
 	TRACE("Entered Method");
-	TRACE("Returning complex float vector of size: " << basebandCmplxUpSampledTuned.size());
+	if (synthesized == this->synthesized) {
+		TRACE("Exited Method");
+		return;
+	}
+
+	this->synthesized = synthesized;
+
+	// The interpolator's history is stale once the station has been synthesized
+	if (not synthesized) {
+		interpolator->reset();
+	}
+
+	if (buffersAllocated) {
+		allocateBuffers();
+	}
 	TRACE("Exited Method");
-	return basebandCmplxUpSampledTuned;
 }
 
+/**
+ * The base rate samples and carrier of a synthesized transmitter.  The input is valid from generate() until the
+ * next block.
+ */
+FftSynthesizer::Channel* Transmitter::getChannel() {
+	return &channel;
+}
+
+
 // Algorithm from: www.w9wi.com/articles/rdsreverse.htm
 unsigned int Transmitter::callSignToInt(std::string callSign) {
 	TRACE("Entered Method");
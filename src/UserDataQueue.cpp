@@ -26,6 +26,11 @@
 #include "UserDataQueue.h"
 #include "DigitizerSimLogger.h"
 #include "boost/bind.hpp"
+#include <time.h>
+#include <algorithm>
+
+// The number of gaps kept for getGaps, older gaps are forgotten
+#define MAX_QUEUE_GAPS 1024
 
 using namespace RfSimulators;
 
@@ -34,13 +39,33 @@ UserDataQueue::UserDataQueue(unsigned short maxQueueDepth, CallbackInterface *us
 	this->maxQueueDepth = maxQueueDepth;
 	this->userClass = userClass;
 	shuttingDown = false;
+	policy = DROP_OLDEST;
 	waitForDataThread = NULL;
+	bufferPool = new SampleBufferPool();
+
+	blocksDelivered.store(0);
+	consumerWaits.store(0);
+	droppedBlocks = 0;
+	droppedSamples = 0;
+	coalescedBlocks = 0;
+	hasDelivered = false;
+	nextSample = 0;
+	for (int i = 0; i < QUEUE_LATENCY_BUCKETS; ++i) {
+		enqueueLatency[i].store(0);
+		dequeueLatency[i].store(0);
+	}
 	TRACE("Leaving Method");
 }
 
 UserDataQueue::~UserDataQueue() {
 	TRACE("Entering Method");
 	shutDown();
+
+	// Drop any blocks the user did not receive before the pool goes
+	while (internalDataBuffer.size() > 0) {
+		internalDataBuffer.pop();
+	}
+	delete(bufferPool);
 	TRACE("Leaving Method");
 }
 
@@ -57,7 +82,7 @@ void UserDataQueue::_waitForData() {
 	TRACE("Entering Method");
 	while(not shuttingDown) {
 
-		std::valarray< std::complex<float> > dataCopy;
+		QueuedBlock block;
 
 		{
 			// This locks the mutex.
@@ -66,6 +91,7 @@ void UserDataQueue::_waitForData() {
 			{
 				// This unlocks the mutex until the wait is over
 				TRACE("Waiting until Data is available");
+				increment(consumerWaits);
 				cond.wait(lock);
 				TRACE("Woken up, checking for data.");
 
@@ -79,16 +105,16 @@ void UserDataQueue::_waitForData() {
 				break;
 			}
 
-			TRACE("Copying data for user.  Size: " << internalDataBuffer.front().size());
-			dataCopy.resize(internalDataBuffer.front().size());
-			dataCopy = internalDataBuffer.front();
-
-			TRACE("Removing data from queue");
+			TRACE("Removing data from queue.  Size: " << internalDataBuffer.front().buffer->size());
+			block = internalDataBuffer.front();
 			internalDataBuffer.pop();
 		}
 
-		TRACE("Passing " << dataCopy.size() << " data points to user");
-		userClass->dataDelivery(dataCopy);
+		spaceAvailable.notify_one();
+		deliverToUser(block);
+
+		// Return the buffer to the pool
+		block.buffer.reset();
 	}
 
 	TRACE("Leaving Method");
@@ -96,8 +122,18 @@ void UserDataQueue::_waitForData() {
 
 void UserDataQueue::shutDown() {
 	TRACE("Entering Method");
-	shuttingDown = true;
+	{
+		boost::lock_guard<boost::mutex> lock(mut);
+		shuttingDown = true;
+	}
 	cond.notify_all();
+	spaceAvailable.notify_all();
+	joinThread();
+	TRACE("Leaving Method");
+}
+
+void UserDataQueue::joinThread() {
+	TRACE("Entering Method");
 	if (waitForDataThread) {
 		waitForDataThread->join();
 	}
@@ -109,12 +145,39 @@ void UserDataQueue::shutDown() {
 	TRACE("Leaving Method");
 }
 
-void UserDataQueue::deliverData(std::valarray< std::complex<float> > &dataArray)
+SampleBufferPool::Buffer UserDataQueue::getBuffer(size_t size) {
+	return bufferPool->acquire(size);
+}
+
+void UserDataQueue::reserveBuffers(size_t size) {
+	TRACE("Entering Method");
+	// The blocks in the queue, plus the block with the user and the one being filled
+	bufferPool->reserve(maxBlocksHeld() + 2, size);
+	TRACE("Leaving Method");
+}
+
+size_t UserDataQueue::maxBlocksHeld() {
+	boost::lock_guard<boost::mutex> lock(mut);
+	return maxQueueDepth;
+}
+
+void UserDataQueue::deliverData(const SampleBufferPool::Buffer &buffer, const BlockMetadata &metadata)
 {
 	TRACE("Entering Method");
+	QueuedBlock block;
+	block.buffer = buffer;
+	block.metadata = metadata;
+	block.enqueueTime = now();
 
     {
-        boost::lock_guard<boost::mutex> lock(mut);
+        boost::unique_lock<boost::mutex> lock(mut);
+
+        if (policy == BLOCK_PRODUCER && maxQueueDepth > 0) {
+        	while (internalDataBuffer.size() >= maxQueueDepth && not shuttingDown) {
+        		TRACE("Waiting for the user to service the queue");
+        		spaceAvailable.wait(lock);
+        	}
+        }
 
         if (shuttingDown) {
         	INFO("Shutting down, refusing to pass data to user.");
@@ -123,28 +186,210 @@ void UserDataQueue::deliverData(std::valarray< std::complex<float> > &dataArray)
 
         if (maxQueueDepth == 0) {
         		ERROR("Queue Size has been set to zero.  You will not receive any data");
-        		// Fall through on purpose to flush queue.
         }
 
-		if (internalDataBuffer.size() > maxQueueDepth) {
-			ERROR("Queue flushing!  Data was not serviced fast enough.");
+		if (internalDataBuffer.size() >= maxQueueDepth) {
+			if (policy == COALESCE && internalDataBuffer.size() > 0
+					&& canCoalesce(internalDataBuffer.back(), block, maxQueueDepth)) {
+				WARN("Queue full, appending block at sample " << metadata.sampleIndex << " to the one before it");
+				coalesce(internalDataBuffer.back(), block);
+				return;
+			}
 
-			while (internalDataBuffer.size() > 0) {
+			if ((policy == DROP_OLDEST || policy == COALESCE) && internalDataBuffer.size() > 0) {
+				ERROR("Queue full!  Dropping the oldest block at sample " << internalDataBuffer.front().metadata.sampleIndex);
+				recordGap(internalDataBuffer.front());
 				internalDataBuffer.pop();
+			} else if (policy == FLUSH_QUEUE) {
+				ERROR("Queue flushing!  Data was not serviced fast enough.");
+				while (internalDataBuffer.size() > 0) {
+					recordGap(internalDataBuffer.front());
+					internalDataBuffer.pop();
+				}
+				recordGap(block);
+				return;
+			} else {
+				ERROR("Queue full!  Dropping the new block at sample " << metadata.sampleIndex);
+				recordGap(block);
+				return;
 			}
-
-			return;
 		}
-		TRACE("Adding array of size: " << dataArray.size() << " to UserDataQueue buffer");
-		internalDataBuffer.push(dataArray);
+
+		TRACE("Adding array of size: " << buffer->size() << " to UserDataQueue buffer");
+		internalDataBuffer.push(block);
     }
 
     cond.notify_one();
+    recordLatency(enqueueLatency, now() - block.enqueueTime);
     TRACE("Leaving Method");
 }
 
 void UserDataQueue::setMaxQueueSize(unsigned short size) {
 	TRACE("Entering Method");
-	maxQueueDepth = size;
+	{
+		boost::lock_guard<boost::mutex> lock(mut);
+		maxQueueDepth = size;
+	}
+	spaceAvailable.notify_all();
 	TRACE("Leaving Method");
 }
+
+void UserDataQueue::setOverflowPolicy(OverflowPolicy policy) {
+	TRACE("Entering Method");
+	{
+		boost::lock_guard<boost::mutex> lock(mut);
+		this->policy = policy;
+	}
+	spaceAvailable.notify_all();
+	TRACE("Leaving Method");
+}
+
+QueueStatistics UserDataQueue::getStatistics() {
+	TRACE("Entering Method");
+	QueueStatistics stats;
+	stats.blocksDelivered = blocksDelivered.load(MEMORY_ORDER_RELAXED);
+	stats.consumerWaits = consumerWaits.load(MEMORY_ORDER_RELAXED);
+	{
+		boost::lock_guard<boost::mutex> lock(gapMutex);
+		stats.droppedBlocks = droppedBlocks;
+		stats.droppedSamples = droppedSamples;
+		stats.coalescedBlocks = coalescedBlocks;
+	}
+	for (int i = 0; i < QUEUE_LATENCY_BUCKETS; ++i) {
+		stats.enqueueLatency[i] = enqueueLatency[i].load(MEMORY_ORDER_RELAXED);
+		stats.dequeueLatency[i] = dequeueLatency[i].load(MEMORY_ORDER_RELAXED);
+	}
+	TRACE("Leaving Method");
+	return stats;
+}
+
+std::vector<QueueGap> UserDataQueue::getGaps() {
+	TRACE("Entering Method");
+	boost::lock_guard<boost::mutex> lock(gapMutex);
+	TRACE("Leaving Method");
+	return std::vector<QueueGap>(gaps.begin(), gaps.end());
+}
+
+/**
+ * Flags what changed since the last block passed to the user and passes this one on
+ */
+void UserDataQueue::deliverToUser(QueuedBlock &block) {
+	recordLatency(dequeueLatency, now() - block.enqueueTime);
+	increment(blocksDelivered);
+
+	BlockMetadata &metadata = block.metadata;
+	if (metadata.sampleIndex != nextSample) {
+		metadata.flags |= SAMPLES_DROPPED;
+	}
+	if (hasDelivered) {
+		if (metadata.centerFrequency != lastDelivered.centerFrequency) {
+			metadata.flags |= RETUNED;
+		}
+		if (metadata.sampleRate != lastDelivered.sampleRate) {
+			metadata.flags |= SAMPLE_RATE_CHANGED;
+		}
+		if (metadata.gain != lastDelivered.gain) {
+			metadata.flags |= GAIN_CHANGED;
+		}
+	}
+	hasDelivered = true;
+	lastDelivered = metadata;
+	nextSample = metadata.sampleIndex + block.buffer->size();
+
+	TRACE("Passing " << block.buffer->size() << " data points to user");
+	userClass->dataDelivery(*block.buffer, metadata);
+}
+
+/**
+ * Counts a dropped block and adds it to the gaps, joining it to any gap it adjoins.  The
+ * blocks of one queue may be dropped out of order by the two threads.
+ */
+void UserDataQueue::recordGap(const QueuedBlock &block) {
+	unsigned long long first = block.metadata.sampleIndex;
+	unsigned long long last = first + block.buffer->size();
+
+	boost::lock_guard<boost::mutex> lock(gapMutex);
+	++droppedBlocks;
+	droppedSamples += block.buffer->size();
+
+	std::deque<QueueGap>::iterator next = gaps.end();
+	while (next != gaps.begin() && (next - 1)->sampleIndex > first) {
+		--next;
+	}
+
+	if (next != gaps.begin() && (next - 1)->sampleIndex + (next - 1)->numSamples == first) {
+		std::deque<QueueGap>::iterator previous = next - 1;
+		previous->numSamples += block.buffer->size();
+		if (next != gaps.end() && next->sampleIndex == last) {
+			previous->numSamples += next->numSamples;
+			gaps.erase(next);
+		}
+	} else if (next != gaps.end() && next->sampleIndex == last) {
+		next->sampleIndex = first;
+		next->numSamples += block.buffer->size();
+	} else {
+		QueueGap gap;
+		gap.sampleIndex = first;
+		gap.numSamples = block.buffer->size();
+		gaps.insert(next, gap);
+		if (gaps.size() > MAX_QUEUE_GAPS) {
+			gaps.pop_front();
+		}
+	}
+}
+
+/**
+ * True if next follows straight on from block with the same settings and the two together
+ * are no longer than depth blocks the size of next.
+ */
+bool UserDataQueue::canCoalesce(const QueuedBlock &block, const QueuedBlock &next, unsigned int depth) {
+	return block.metadata.sampleIndex + block.buffer->size() == next.metadata.sampleIndex
+			&& block.metadata.centerFrequency == next.metadata.centerFrequency
+			&& block.metadata.sampleRate == next.metadata.sampleRate
+			&& block.metadata.gain == next.metadata.gain
+			&& block.buffer->size() + next.buffer->size() <= depth * next.buffer->size();
+}
+
+/**
+ * Appends the samples of next to block in a buffer from the pool.  Only the thread that
+ * delivers data may call this.
+ *
+ * A valarray can not grow in place, so each append copies both blocks into a new, larger
+ * buffer.  Buffers are pooled by exact size, and the joined sizes are not reserved up front,
+ * so while the queue keeps overflowing most appends allocate, either a new buffer or by
+ * resizing a free one of another size.  The number of pooled buffers stays bounded, as the
+ * buffer that held block is free again once the append returns.
+ */
+void UserDataQueue::coalesce(QueuedBlock &block, const QueuedBlock &next) {
+	size_t size = block.buffer->size();
+	SampleBufferPool::Buffer joined = bufferPool->acquire(size + next.buffer->size());
+	std::copy(&(*block.buffer)[0], &(*block.buffer)[0] + size, &(*joined)[0]);
+	std::copy(&(*next.buffer)[0], &(*next.buffer)[0] + next.buffer->size(), &(*joined)[size]);
+	block.buffer = joined;
+	block.metadata.flags |= COALESCED;
+
+	boost::lock_guard<boost::mutex> lock(gapMutex);
+	++coalescedBlocks;
+}
+
+/**
+ * Returns a monotonic time in nanoseconds
+ */
+unsigned long long UserDataQueue::now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void UserDataQueue::increment(AtomicValue<unsigned long long> &counter) {
+	counter.store(counter.load(MEMORY_ORDER_RELAXED) + 1, MEMORY_ORDER_RELAXED);
+}
+
+void UserDataQueue::recordLatency(AtomicValue<unsigned long long> *histogram, unsigned long long nanoseconds) {
+	int bucket = 0;
+	while (nanoseconds > 1 && bucket < QUEUE_LATENCY_BUCKETS - 1) {
+		nanoseconds >>= 1;
+		++bucket;
+	}
+	increment(histogram[bucket]);
+}
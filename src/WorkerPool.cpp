@@ -0,0 +1,240 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ * WorkerPool.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "WorkerPool.h"
+#include "DigitizerSimLogger.h"
+#include "boost/bind.hpp"
+#include <exception>
+
+using namespace boost::posix_time;
+
+WorkerPool::WorkerPool(unsigned int numThreads) {
+	TRACE("Entering Method");
+	shuttingDown = false;
+	outstandingJobs = 0;
+	queuedJobs = 0;
+	nextWorker = 0;
+
+	if (numThreads == 0) {
+		numThreads = boost::thread::hardware_concurrency();
+	}
+
+	// hardware_concurrency may return 0 if the information is not available
+	if (numThreads == 0) {
+		numThreads = 1;
+	}
+
+	for (unsigned int i = 0; i < numThreads; ++i) {
+		Worker *worker = new Worker();
+		worker->jobsExecuted = 0;
+		worker->jobsStolen = 0;
+		worker->jobsFailed = 0;
+		worker->busyTime = seconds(0);
+		workers.push_back(worker);
+	}
+
+	startTime = microsec_clock::universal_time();
+
+	INFO("Launching " << numThreads << " worker threads");
+	for (unsigned int i = 0; i < numThreads; ++i) {
+		threads.create_thread(boost::bind(&WorkerPool::workerLoop, this, i));
+	}
+	TRACE("Leaving Method");
+}
+
+WorkerPool::~WorkerPool() {
+	TRACE("Entering Method");
+	{
+		boost::lock_guard<boost::mutex> lock(mut);
+		shuttingDown = true;
+	}
+	jobReady.notify_all();
+
+	TRACE("Joining worker threads");
+	threads.join_all();
+
+	for (unsigned int i = 0; i < workers.size(); ++i) {
+		delete(workers[i]);
+	}
+	workers.clear();
+	TRACE("Leaving Method");
+}
+
+void WorkerPool::post(const Job &job) {
+	unsigned int index;
+
+	{
+		boost::lock_guard<boost::mutex> lock(mut);
+		++outstandingJobs;
+
+		if (workerIndex.get()) {
+			// Posted from within a job, keep it local to this worker.
+			index = *workerIndex;
+		} else {
+			index = nextWorker;
+			nextWorker = (nextWorker + 1) % workers.size();
+		}
+	}
+
+	{
+		boost::lock_guard<boost::mutex> lock(workers[index]->mut);
+		workers[index]->jobs.push_back(job);
+	}
+
+	// The job must be on a deque before it is counted as queued so a woken worker can find it.
+	{
+		boost::lock_guard<boost::mutex> lock(mut);
+		++queuedJobs;
+	}
+	jobReady.notify_one();
+}
+
+void WorkerPool::wait() {
+	boost::unique_lock<boost::mutex> lock(mut);
+	while (outstandingJobs != 0) {
+		jobsComplete.wait(lock);
+	}
+}
+
+unsigned int WorkerPool::size() {
+	return workers.size();
+}
+
+std::vector<RfSimulators::WorkerStatistics> WorkerPool::getStatistics() {
+	std::vector<RfSimulators::WorkerStatistics> stats(workers.size());
+	double elapsed = (microsec_clock::universal_time() - startTime).total_microseconds() / 1e6;
+
+	for (unsigned int i = 0; i < workers.size(); ++i) {
+		boost::lock_guard<boost::mutex> lock(workers[i]->mut);
+		stats[i].jobsExecuted = workers[i]->jobsExecuted;
+		stats[i].jobsStolen = workers[i]->jobsStolen;
+		stats[i].jobsFailed = workers[i]->jobsFailed;
+		stats[i].busySeconds = workers[i]->busyTime.total_microseconds() / 1e6;
+		stats[i].elapsedSeconds = elapsed;
+		stats[i].utilization = (elapsed > 0) ? stats[i].busySeconds / elapsed : 0.0;
+	}
+
+	return stats;
+}
+
+/**
+ * Takes the newest job from this worker's deque or, failing that, the oldest job
+ * from another worker.  Returns false if every deque was empty.
+ */
+bool WorkerPool::takeJob(unsigned int index, Job &job) {
+	{
+		boost::lock_guard<boost::mutex> lock(workers[index]->mut);
+		if (not workers[index]->jobs.empty()) {
+			job = workers[index]->jobs.back();
+			workers[index]->jobs.pop_back();
+			return true;
+		}
+	}
+
+	for (unsigned int i = 1; i < workers.size(); ++i) {
+		unsigned int victim = (index + i) % workers.size();
+		bool stolen = false;
+
+		{
+			boost::lock_guard<boost::mutex> lock(workers[victim]->mut);
+			if (not workers[victim]->jobs.empty()) {
+				job = workers[victim]->jobs.front();
+				workers[victim]->jobs.pop_front();
+				stolen = true;
+			}
+		}
+
+		if (stolen) {
+			boost::lock_guard<boost::mutex> lock(workers[index]->mut);
+			++workers[index]->jobsStolen;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void WorkerPool::workerLoop(unsigned int index) {
+	TRACE("Entering Method");
+	workerIndex.reset(new unsigned int(index));
+
+	while (true) {
+		{
+			boost::unique_lock<boost::mutex> lock(mut);
+			while (queuedJobs <= 0 && not shuttingDown) {
+				jobReady.wait(lock);
+			}
+
+			if (shuttingDown) {
+				break;
+			}
+
+			// Claim a job while holding the lock so other workers go back to waiting
+			// rather than searching the deques for it.
+			--queuedJobs;
+		}
+
+		// A job is counted as queued only once it is on a deque, so there is one for every
+		// claim.  The search may still miss it if it was posted to a deque already passed
+		// while another worker took the one this worker was heading for, so search again.
+		Job job;
+		while (not takeJob(index, job)) {
+			boost::this_thread::yield();
+		}
+
+		// An exception must not escape the job, the job would never be counted as complete
+		// and wait() would block forever.
+		bool failed = false;
+		ptime jobStart = microsec_clock::universal_time();
+		try {
+			job();
+		} catch (std::exception const &e) {
+			ERROR("Worker " << index << " job failed: " << e.what());
+			failed = true;
+		} catch (...) {
+			ERROR("Worker " << index << " job failed with an unknown exception");
+			failed = true;
+		}
+		time_duration jobTime = microsec_clock::universal_time() - jobStart;
+
+		{
+			boost::lock_guard<boost::mutex> lock(workers[index]->mut);
+			++workers[index]->jobsExecuted;
+			if (failed) {
+				++workers[index]->jobsFailed;
+			}
+			workers[index]->busyTime += jobTime;
+		}
+
+		{
+			boost::lock_guard<boost::mutex> lock(mut);
+			--outstandingJobs;
+			if (outstandingJobs == 0) {
+				jobsComplete.notify_all();
+			}
+		}
+	}
+	TRACE("Leaving Method");
+}
@@ -0,0 +1,115 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _FFTSYNTHESIZER_H
+#define _FFTSYNTHESIZER_H
+
+#include <vector>
+#include "DataTypes.h"
+#include "fft.h"
+
+/**
+ * \brief Overlap-add synthesis filterbank that interpolates, shifts and sums
+ *        many channels with a single inverse FFT per frame
+ *
+ * The input of every channel is cut into frames of frameLength() samples.
+ * Each frame is transformed with an fftSize point FFT, which is the spectrum
+ * of the frame zero stuffed by factor at fftSize * factor points.  The bins
+ * passed by the interpolation prototype are weighted by its response and
+ * added into a shared wideband spectrum, rotated to the bin nearest the
+ * channel's shift.  One inverse FFT of the shared spectrum then yields the
+ * interpolated, shifted and summed frame, which is overlap-added into the
+ * output.  The part of the shift that is not a whole bin is applied to the
+ * frame at the input rate before its FFT.
+ *
+ * The frames of a block are split evenly across the workspaces so that each
+ * may be synthesized on its own thread.  finishBlock() then joins the
+ * overlaps between the ranges and carries the end of the block to the next.
+ */
+class FftSynthesizer
+{
+public:
+    /**
+     * The state of one channel.  Owned by the caller and only advanced by
+     * finishBlock().
+     */
+    struct Channel
+    {
+        Channel(void);
+
+        const Complex *input;   ///< The block of input samples
+        double shift;           ///< Frequency shift in cycles per output sample
+        double cycles;          ///< Carrier phase, in cycles, at the start of the block
+    };
+
+    FftSynthesizer(size_t factor, const RealArray &prototype, size_t fftSize, Real attenuation);
+    virtual ~FftSynthesizer(void);
+
+    void setNumWorkspaces(size_t numWorkspaces);
+    size_t numWorkspaces(void);
+    virtual void run(const std::vector<Channel *> &channels, size_t numIn, Complex *output, size_t workspace);
+    virtual void finishBlock(std::vector<Channel *> &channels, size_t numIn, Complex *output);
+    virtual void reset(void);
+    size_t factor(void);
+    size_t frameLength(void);
+    size_t numBins(void);
+
+protected:
+    /**
+     * The buffers and FFT plans used to synthesize one range of frames
+     */
+    struct Workspace
+    {
+        Workspace(size_t fftSize, size_t outputFftSize, size_t tailSize);
+        ~Workspace(void);
+
+        ComplexFFTWVector frame;        ///< One frame of one channel, zero padded
+        ComplexFFTWVector frameFreq;    ///< Its spectrum
+        ComplexFFTWVector spectrum;     ///< The sum of the channels at the output rate
+        ComplexFFTWVector composite;    ///< The inverse of the sum
+        ComplexFwdFft *fwd;
+        ComplexRevFft *rev;
+        ComplexArray tail;              ///< Output of the range that falls past its end
+        size_t end;                     ///< Output index of the end of the range
+
+    private:
+        Workspace(const Workspace &);
+        Workspace &operator=(const Workspace &);
+    };
+
+    void synthesizeFrame(const std::vector<Channel *> &channels, size_t frameStart, size_t count, Workspace &ws);
+
+    size_t _factor;
+    size_t _fftSize;
+    size_t _outputFftSize;
+    size_t _frameLength;
+    size_t _tailSize;                   ///< Samples of a frame's output past factor times its length
+    std::vector<size_t> _bins;          ///< Output bins passed by the prototype
+    std::vector<size_t> _sources;       ///< The frame bin that is the image at each of them
+    ComplexVector _response;            ///< The prototype's response at those bins, scaled for the inverse FFT
+    ComplexVector _slope;               ///< The change in the response per bin
+    std::vector<Workspace *> _workspaces;
+    ComplexArray _carry;                ///< Output of the last block that falls in the next
+
+private:
+    FftSynthesizer();                   // No default constructor
+    FftSynthesizer(const FftSynthesizer &);
+    FftSynthesizer &operator=(const FftSynthesizer &);
+};
+
+#endif // _FFTSYNTHESIZER_H
@@ -0,0 +1,75 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _FIRKERNEL_H
+#define _FIRKERNEL_H
+
+#include "DataTypes.h"
+#include "KernelSelect.h"
+
+/**
+ * \brief Vectorized inner loops for filtering complex samples with real taps
+ *
+ * The kernel is chosen once at load time from the instruction sets supported
+ * by the CPU (AVX-512, AVX2, SSE2 or NEON) with a portable scalar fallback.
+ * Every kernel accumulates the taps of an output in the same order as the
+ * scalar loop and none of them fuse the multiply and add, so all kernels
+ * produce the same results as FIRFilter's original loop.
+ */
+namespace FirKernel
+{
+    /**
+     * Filters count outputs where
+     *   out[i] = sum over j of taps[j] * in[i + numTaps - 1 - j]
+     * for j = 0 to numTaps - 1.  The input must hold count + numTaps - 1
+     * samples and may not overlap the output.
+     */
+    void filter(const Complex *in, Complex *out, size_t count,
+        const Real *taps, size_t numTaps);
+
+    /**
+     * Polyphase interpolation by factor, producing factor outputs per input
+     *   out[n * factor + p] = sum over k of h[p + factor * k] * in[n + tapsPerPhase - 1 - k]
+     * for k = 0 to tapsPerPhase - 1, with h the prototype filter.  The taps
+     * are laid out as tapsPerPhase rows of 2 * factor values, row k holding
+     * h[p + factor * k] twice for each phase p so a row lines up with the
+     * interleaved real and imaginary parts of the outputs.  The input must
+     * hold count + tapsPerPhase - 1 samples.
+     */
+    void interpolate(const Complex *in, Complex *out, size_t count,
+        const Real *taps, size_t factor, size_t tapsPerPhase);
+
+    /**
+     * Filters and decimates by factor, producing only the kept outputs
+     *   out[i] = sum over j of taps[j] * in[i * factor + numTaps - 1 - j]
+     * for j = 0 to numTaps - 1.  The input must hold
+     * (count - 1) * factor + numTaps samples.
+     */
+    void decimate(const Complex *in, Complex *out, size_t count,
+        const Real *taps, size_t numTaps, size_t factor);
+
+    /**
+     * Forces a particular kernel, mainly for testing and benchmarking.
+     * Returns false, leaving the current kernel in place, if the CPU or
+     * compiler does not support it.  automatic restores the default choice.
+     */
+    bool select(KernelSelect::kernel_type type);
+    KernelSelect::kernel_type selected(void);
+}
+
+#endif // _FIRKERNEL_H
@@ -0,0 +1,60 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _GAUSSIANNOISE_H
+#define _GAUSSIANNOISE_H
+
+#include <stdint.h>
+#include "DataTypes.h"
+
+/**
+ * \brief Stream of complex white Gaussian noise that never repeats
+ *
+ * Sample n of the stream is a function of the seed and n alone.  Every pair
+ * of samples comes from one counter of the Philox4x32-10 random number
+ * generator, whose four words are turned into two complex samples by the
+ * Box-Muller transform, so any part of the stream can be generated without
+ * the parts before it.  add() continues the stream from position() while
+ * the const form generates any range, so a block can be split across threads
+ * by sample offset.
+ */
+class GaussianNoise
+{
+public:
+    GaussianNoise(uint64_t seed, Real sigma);
+    virtual ~GaussianNoise(void);
+
+    void add(Complex *data, size_t count);
+    void add(Complex *data, size_t count, uint64_t first) const;
+    void setSeed(uint64_t seed);
+    uint64_t seed(void) const;
+    void setSigma(Real sigma);
+    Real sigma(void) const;
+    void seek(uint64_t position);
+    uint64_t position(void) const;
+
+protected:
+    uint64_t _seed;
+    Real _sigma;
+    uint64_t _position;                 ///< The stream index of the next sample added
+
+private:
+    GaussianNoise();                    // No default constructor
+};
+
+#endif // _GAUSSIANNOISE_H
@@ -0,0 +1,59 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _HALFBANDDECIMATOR_H
+#define _HALFBANDDECIMATOR_H
+
+#include "DataTypes.h"
+#include "PolyphaseDecimator.h"
+
+/**
+ * \brief Decimator by two with a halfband filter that skips the zero taps
+ *
+ * A halfband lowpass has its cutoff at a quarter of the input rate.  With an
+ * odd number of taps every other tap either side of the center is zero, so
+ * an output needs one multiply for the center tap and one for each of the
+ * (numTaps - 1) / 2 taps at odd distances from it.  Those taps all meet
+ * inputs of the same parity, which are gathered into a contiguous buffer and
+ * filtered by FirKernel at the output rate.
+ *
+ * The filter history and puncture index are kept by PolyphaseDecimator.
+ */
+class HalfbandDecimator : public PolyphaseDecimator
+{
+public:
+    HalfbandDecimator(const RealArray &taps);
+    virtual ~HalfbandDecimator(void);
+
+    virtual size_t multipliesPerOutput(void);
+
+    static void design(RealArray &taps, Real ripple, Real twNorm);
+
+protected:
+    virtual void decimate(const Complex *in, Complex *out, size_t count);
+
+    RealArray _oddTaps;         ///< The taps at odd distances from the center
+    size_t _oddStart;           ///< Parity of the first of them, and of the inputs they meet
+    size_t _center;             ///< Index of the center tap
+    ComplexArray _gathered;     ///< The inputs the odd taps meet, grown as needed
+
+private:
+    HalfbandDecimator();        // No default constructor
+};
+
+#endif // _HALFBANDDECIMATOR_H
@@ -0,0 +1,70 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _KERNELSELECT_H
+#define _KERNELSELECT_H
+
+// Runtime dispatch needs the target attribute and __builtin_cpu_supports
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#  if (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)
+#    define KERNEL_SELECT_X86
+#  endif
+#  if (__GNUC__ >= 6)
+#    define KERNEL_SELECT_AVX512
+#  endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  define KERNEL_SELECT_NEON
+#endif
+
+/**
+ * \brief The instruction sets the vectorized kernels are written for and
+ *        the runtime check of which of them the CPU supports
+ *
+ * FirKernel and SignalKernel each keep a table of kernels per type and pick
+ * the best supported one at load time.  Their kernels are compiled only when
+ * the KERNEL_SELECT_ macros above are defined.
+ */
+namespace KernelSelect
+{
+    typedef enum
+    {
+        automatic = 0,
+        scalar    = 1,
+        sse2      = 2,
+        avx2      = 3,
+        avx512    = 4,
+        neon      = 5
+    } kernel_type;
+
+    /**
+     * Returns true if both the compiler and the CPU support the kernels of
+     * the given type.  The scalar kernels are always supported.
+     */
+    bool supported(kernel_type type);
+
+    /**
+     * Returns the fastest supported type, automatic resolves to this.
+     */
+    kernel_type best(void);
+
+    const char *name(kernel_type type);
+}
+
+#endif // _KERNELSELECT_H
@@ -0,0 +1,67 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _MULTISTAGEDECIMATOR_H
+#define _MULTISTAGEDECIMATOR_H
+
+#include <vector>
+#include "DataTypes.h"
+#include "PolyphaseDecimator.h"
+
+/**
+ * \brief Decimator that splits a large rate reduction into a cascade of stages
+ *
+ * The factor is broken into its prime factors, largest first.  Every stage
+ * but the last only has to keep its aliases out of the output band, so its
+ * transition band is wide and its filter short, and every factor of two among
+ * them is a halfband, run by HalfbandDecimator so the taps that are zero by
+ * construction cost nothing.  The last stage is the shaping filter, with the sharp
+ * transition from the passband to the output Nyquist rate.  Each stage is a Kaiser window design sized by
+ * FirFilterDesigner for the requested stopband attenuation.
+ *
+ * A factor of one passes the input through unfiltered.
+ */
+class MultistageDecimator
+{
+public:
+    MultistageDecimator(size_t factor, Real passband, Real attenuation);
+    virtual ~MultistageDecimator(void);
+
+    virtual size_t outputSize(size_t inputSize) const;
+    virtual size_t run(const ComplexArray &input, Complex *output);
+    virtual void reset(void);
+    size_t factor(void);
+    size_t numStages(void);
+    size_t multipliesPerOutput(void);
+    Real noiseGain(void);
+    Real noiseBandwidth(void);
+
+protected:
+    size_t _factor;
+    std::vector<PolyphaseDecimator *> _stages;
+    std::vector<ComplexArray> _buffers;     ///< The output of every stage but the last
+    Real _noiseGain;                        ///< Output noise power per unit of white input noise
+    Real _noiseBandwidth;                   ///< Relative to the output rate
+
+private:
+    MultistageDecimator();                  // No default constructor
+    MultistageDecimator(const MultistageDecimator &);
+    MultistageDecimator &operator=(const MultistageDecimator &);
+};
+
+#endif // _MULTISTAGEDECIMATOR_H
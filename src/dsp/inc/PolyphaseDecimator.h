@@ -0,0 +1,64 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _POLYPHASEDECIMATOR_H
+#define _POLYPHASEDECIMATOR_H
+
+#include "DataTypes.h"
+
+/**
+ * \brief Integer factor decimator that only filters the samples it keeps
+ *
+ * Keeping one output in factor from a low pass filter, then throwing the rest
+ * away, wastes all but one in factor of the filter's work.  Only the kept
+ * outputs are computed here, which costs the same as running the factor
+ * polyphase branches of the filter at the output rate.
+ *
+ * The filter history and the puncture index, the position of the next kept
+ * sample, are carried from one call of run() to the next so consecutive
+ * blocks of any size are decimated as one continuous stream.  The filter is
+ * causal, so the output lags the input by the filter's group delay.
+ */
+class PolyphaseDecimator
+{
+public:
+    PolyphaseDecimator(size_t factor, const RealArray &taps);
+    virtual ~PolyphaseDecimator(void);
+
+    virtual size_t outputSize(size_t inputSize) const;
+    virtual size_t run(const ComplexArray &input, Complex *output);
+    virtual size_t run(const Complex *input, size_t numIn, Complex *output);
+    virtual void reset(void);
+    size_t factor(void);
+    size_t numTaps(void);
+    virtual size_t multipliesPerOutput(void);
+
+protected:
+    virtual void decimate(const Complex *in, Complex *out, size_t count);
+
+    size_t _factor;
+    RealArray _taps;
+    ComplexArray _hist;         ///< The last numTaps - 1 inputs of the previous block
+    ComplexArray _stitch;       ///< History joined to the start of the current block
+    size_t _pi;                 ///< The puncture index, where the next kept sample falls in the next block
+
+private:
+    PolyphaseDecimator();       // No default constructor
+};
+
+#endif // _POLYPHASEDECIMATOR_H
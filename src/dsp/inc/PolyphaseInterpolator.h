@@ -0,0 +1,58 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _POLYPHASEINTERPOLATOR_H
+#define _POLYPHASEINTERPOLATOR_H
+
+#include "DataTypes.h"
+
+/**
+ * \brief Integer factor interpolator using a polyphase filter bank
+ *
+ * The prototype low pass filter, designed at the output sample rate, is split
+ * into factor phases of ceil(taps / factor) coefficients.  Each call to run()
+ * produces factor outputs per input sample in a single pass, writing them in
+ * order.  The last inputs of each block are kept so consecutive blocks are
+ * filtered as one continuous stream.
+ */
+class PolyphaseInterpolator
+{
+public:
+    PolyphaseInterpolator(const ComplexArray &input, ComplexArray &output,
+        size_t factor, const RealArray &prototype);
+    virtual ~PolyphaseInterpolator(void);
+
+    virtual void run(void);
+    virtual void reset(void);
+    size_t factor(void);
+    size_t tapsPerPhase(void);
+
+protected:
+    const ComplexArray &vIn;
+    ComplexArray &vOut;
+    size_t _factor;
+    size_t _tapsPerPhase;
+    RealArray _taps;            ///< Phase taps duplicated to line up with interleaved complex outputs
+    ComplexArray _hist;         ///< The last tapsPerPhase - 1 inputs of the previous block
+    ComplexArray _stitch;       ///< History joined to the start of the current block
+
+private:
+    PolyphaseInterpolator();    // No default constructor
+};
+
+#endif // _POLYPHASEINTERPOLATOR_H
@@ -0,0 +1,91 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+
+#ifndef _SIGNALKERNEL_H
+#define _SIGNALKERNEL_H
+
+#include <stdint.h>
+#include "DataTypes.h"
+#include "KernelSelect.h"
+
+/**
+ * \brief Vectorized inner loops for frequency shifting complex samples, for
+ *        forming oscillator phasors and for generating Gaussian noise
+ *
+ * The kernel is chosen once at load time in the same way as FirKernel's.
+ * Every kernel performs the operations of the scalar kernel in the same
+ * order, so all kernels produce the same results.
+ */
+namespace SignalKernel
+{
+    /**
+     * Number of oscillator phasors rotate() advances side by side.  Every
+     * kernel uses the same number so all of them produce the same results.
+     */
+    const size_t ROTATE_LANES = 8;
+
+    /**
+     * Multiplies the samples by an oscillator, writing or, when accumulate is
+     * set, adding the products to the output
+     *   out[i] = in[i] * phasors[i % ROTATE_LANES] * step^(i / ROTATE_LANES)
+     * phasors holds the oscillator at the first ROTATE_LANES samples and step
+     * is its advance over ROTATE_LANES samples.  Rounding errors in the
+     * phasors grow with count / ROTATE_LANES so long runs should be split,
+     * starting each piece from an accurately computed phase.
+     */
+    void rotate(const Complex *in, Complex *out, size_t count,
+        const Complex *phasors, Complex step, bool accumulate);
+
+    /**
+     * Forms the unit phasors of fixed point phases
+     *   out[i] = cos(a) + j sin(a), a = 2 * pi * phases[i] / 2^32
+     * from polynomials over the nearest quarter cycle, accurate to about
+     * 1.2e-7.
+     */
+    void sincos(const uint32_t *phases, Complex *out, size_t count);
+
+    /**
+     * Fills words with the Philox4x32-10 random numbers of the counters
+     * counter to counter + count - 1 under the 64 bit key, four words per
+     * counter.  The counter occupies the first two words of the Philox
+     * counter, low half first, and the key is split the same way.
+     */
+    void philox(uint64_t counter, uint64_t key, uint32_t *words, size_t count);
+
+    /**
+     * Turns pairs of uniform random words into complex Gaussian samples
+     * with independent real and imaginary parts of standard deviation sigma
+     * using the Box-Muller transform.  Sample i takes its magnitude from
+     * words[2 * i] and its phase from words[2 * i + 1].  The logarithm is a
+     * polynomial accurate to a few parts in 1e7 and the phasor is that of
+     * sincos().  The samples are written or, when accumulate is set, added
+     * to the output.
+     */
+    void gaussian(const uint32_t *words, Complex *out, size_t count, Real sigma,
+        bool accumulate);
+
+    /**
+     * Forces a particular kernel, mainly for testing and benchmarking.
+     * Returns false, leaving the current kernel in place, if the CPU or
+     * compiler does not support it.  automatic restores the default choice.
+     */
+    bool select(KernelSelect::kernel_type type);
+    KernelSelect::kernel_type selected(void);
+}
+
+#endif // _SIGNALKERNEL_H
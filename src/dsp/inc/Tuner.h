@@ -22,6 +22,7 @@
 //#define TUNER_DEBUG // Comment out to disable
 
 #include "DataTypes.h"
+#include "SignalKernel.h"
 
 /**
  * \brief Tuner class
@@ -34,16 +35,22 @@ public:
     virtual ~Tuner();
 
     bool run(void);
+    bool run(size_t first, size_t count);
+    bool accumulate(size_t first, size_t count, Complex *output);
+    void advance(size_t count);
     void retune(Real normFc);
     void reset(void);
 
 private:
+    void shift(size_t first, size_t count, Complex *output, bool accumulate);
+
     ComplexArray    &_input;               // Reference to input buffer
     ComplexArray    &_output;              // Reference to output buffer
 
     double          _cycles;              // Current phase in cycles (fs maps to 1)
     double 		 	_dcycles;             // Phase increment in cycles
-    Complex 		_dphasor;			  // Complex phasor representing Phase increment
+    std::complex<double> _laneOffsets[SignalKernel::ROTATE_LANES]; // Phase of each oscillator lane relative to the first
+    Complex         _laneStep;            // Phase increment of each lane
 
 #ifdef TUNER_DEBUG
     ComplexVector phasorVec;
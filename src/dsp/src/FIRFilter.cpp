@@ -27,6 +27,7 @@
 
 #include <stdexcept>
 #include "FIRFilter.h"
+#include "FirKernel.h"
 
 //
 // Parameter limits
@@ -155,6 +156,9 @@ FIRFilter::~FIRFilter(void)
 //   buffer contains all the samples to process, so it modifies the filtering at
 //   the endpoints and it does not use the filtering memory buffer.
 //
+//   The outputs for which every tap overlaps the input are handed to the
+//   vectorized kernel, the endpoints are accumulated here.
+//
 // Parameters:
 //   None.
 //
@@ -166,47 +170,41 @@ FIRFilter::~FIRFilter(void)
 void FIRFilter::run(void)
 {
     // Set up coefficients
-    const Real *startCoef = &_filtCoeff[0];
+    const Real *coef = &_filtCoeff[0];
     size_t m_length(_filtCoeff.size());
     size_t lenCoef2 = (m_length + 1) / 2;
+    size_t numIn = vIn.size();
 
-    // Set up input data pointers
-    const Complex *endIn = &vIn[vIn.size() - 1];
-    const Complex *ptrIn = &vIn[lenCoef2 - 1];
+    if (numIn == 0)
+        return;
 
-    // Initial value of accumulation length for startup
-    size_t lenAcc = lenCoef2;
+    // Output ii is centered on input ii + lenCoef2 - 1.  The outputs in
+    // [fullStart, fullEnd) use every tap.
+    size_t fullStart = m_length - lenCoef2;
+    size_t fullEnd = (numIn + 1 > m_length) ? numIn + 1 - lenCoef2 : fullStart;
 
-    for(size_t ii = 0; ii < vIn.size(); ++ii)
+    for(size_t ii = 0; ii < numIn; ++ii)
     {
-        // Set up pointers for accumulation
-        const Complex *ptrData = ptrIn;
-        const Real *ptrCoef = startCoef;
+        if (ii == fullStart && fullEnd > fullStart)
+        {
+            FirKernel::filter(&vIn[0], &vOut[fullStart], fullEnd - fullStart, coef, m_length);
+            ii = fullEnd - 1;
+            continue;
+        }
+
+        // Only the taps that overlap the input, in the same order as the kernel
+        size_t center = ii + lenCoef2 - 1;
+        size_t firstTap = (center > numIn - 1) ? center - (numIn - 1) : 0;
+        size_t lastTap = (center < m_length - 1) ? center : m_length - 1;
+
+        const Complex *ptrData = &vIn[center - firstTap];
+        const Real *ptrCoef = coef + firstTap;
 
         // Do accumulation and write result
         Complex acc = *ptrCoef++ * *ptrData--;
-        for( size_t jj = 1; jj < lenAcc; jj++ )
+        for( size_t jj = firstTap + 1; jj <= lastTap; jj++ )
             acc += *ptrCoef++ * *ptrData--;
         vOut[ii] = acc;
-
-        // Check for end case
-        if( ptrIn == endIn )
-        {
-            // One shorter each time
-            lenAcc--;
-            // Next coefficient each time
-            startCoef++;
-        }
-        else
-        {
-            // Check for startup
-            if( lenAcc < m_length )
-            {
-                // Add to input pointer
-                lenAcc++;
-            }
-            ptrIn++;
-        }
     }
 }
 
@@ -0,0 +1,416 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the FftSynthesizer class implementation.
+//
+//   Zero stuffing a frame of M input samples by a factor I gives a signal
+//   whose N = I * M point spectrum is the M point spectrum of the frame
+//   repeated I times.  Filtering it with the prototype is a product with the
+//   prototype's N point response, which is zero outside a narrow set of bins,
+//   and shifting it by a whole number of bins is a rotation.  So long as the
+//   frame plus the prototype's length fits in N samples the circular
+//   convolution of the inverse FFT is the linear one.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "FftSynthesizer.h"
+
+
+FftSynthesizer::Channel::Channel(void) :
+    input(NULL),
+    shift(0.0),
+    cycles(0.0)
+{
+}
+
+
+FftSynthesizer::Workspace::Workspace(size_t fftSize, size_t outputFftSize, size_t tailSize) :
+    frame(fftSize),
+    frameFreq(fftSize),
+    spectrum(outputFftSize),
+    composite(outputFftSize),
+    fwd(NULL),
+    rev(NULL),
+    tail(Complex(0,0), tailSize),
+    end(0)
+{
+    fwd = new ComplexFwdFft(frame, frameFreq, fftSize, false);
+    rev = new ComplexRevFft(composite, spectrum, outputFftSize, false);
+}
+
+
+FftSynthesizer::Workspace::~Workspace(void)
+{
+    delete fwd;
+    delete rev;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   FftSynthesizer's constructor.  Computes the prototype's response at the
+//   output FFT size and keeps the bins within the attenuation of its peak.
+//
+// Parameters:
+//   factor - the interpolation factor
+//   prototype - the low pass filter coefficients at the output sample rate
+//   fftSize - the size of the FFT of each frame of input.  The inverse FFT
+//       is factor times this.
+//   attenuation - bins where the prototype's response is this many dB below
+//       its peak are dropped
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+FftSynthesizer::FftSynthesizer(size_t factor, const RealArray &prototype, size_t fftSize, Real attenuation) :
+    _factor(factor),
+    _fftSize(fftSize),
+    _outputFftSize(factor * fftSize)
+{
+    // Validate parameters
+    if( factor == 0 )
+        throw std::invalid_argument( "Interpolation factor must be at least 1" );
+    if( prototype.size() == 0 )
+        throw std::invalid_argument( "Empty filter coefficients" );
+
+    _tailSize = prototype.size() - 1;
+    if( _outputFftSize <= _tailSize + _factor )
+        throw std::invalid_argument( "FFT size is too small for the filter" );
+
+    // The largest frame whose filtered output does not wrap around the inverse FFT
+    _frameLength = (_outputFftSize - _tailSize) / _factor;
+
+    size_t N = _outputFftSize;
+    std::vector<std::complex<double> > twiddles(N);
+    for (size_t ii = 0; ii < N; ++ii)
+        twiddles[ii] = std::polar(1.0, -2.0 * M_PI * ii / N);
+
+    // The response and its derivative with respect to the bin
+    std::vector<std::complex<double> > response(N), slope(N);
+    double peak = 0.0;
+    for (size_t kk = 0; kk < N; ++kk)
+    {
+        std::complex<double> sum(0.0, 0.0), dsum(0.0, 0.0);
+        for (size_t pp = 0; pp < prototype.size(); ++pp)
+        {
+            std::complex<double> term = double(prototype[pp]) * twiddles[(kk * pp) % N];
+            sum += term;
+            dsum += term * std::complex<double>(0.0, -2.0 * M_PI * pp / N);
+        }
+        response[kk] = sum;
+        slope[kk] = dsum;
+        peak = std::max(peak, std::abs(sum));
+    }
+
+    // The inverse FFT is not normalized, so its scaling is folded in here
+    double threshold = peak * pow(10.0, -attenuation / 20.0);
+    for (size_t kk = 0; kk < N; ++kk)
+    {
+        if (std::abs(response[kk]) >= threshold)
+        {
+            _bins.push_back(kk);
+            _sources.push_back(kk % _fftSize);
+            _response.push_back(Complex(response[kk] / double(N)));
+            _slope.push_back(Complex(slope[kk] / double(N)));
+        }
+    }
+
+    _carry.resize(_tailSize, Complex(0,0));
+    setNumWorkspaces(1);
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   FftSynthesizer's destructor.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+FftSynthesizer::~FftSynthesizer(void)
+{
+    for (size_t ii = 0; ii < _workspaces.size(); ++ii)
+        delete _workspaces[ii];
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Sets the number of ranges the frames of a block are split into, each
+//   with its own buffers and FFT plans.  Creating the plans is not thread
+//   safe so this must not be called while any other FFTs are being planned.
+//
+// Parameters:
+//   numWorkspaces - the number of ranges, at least one
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void FftSynthesizer::setNumWorkspaces(size_t numWorkspaces)
+{
+    numWorkspaces = std::max(numWorkspaces, size_t(1));
+
+    while (_workspaces.size() > numWorkspaces)
+    {
+        delete _workspaces.back();
+        _workspaces.pop_back();
+    }
+
+    while (_workspaces.size() < numWorkspaces)
+        _workspaces.push_back(new Workspace(_fftSize, _outputFftSize, _tailSize));
+}
+
+
+size_t FftSynthesizer::numWorkspaces(void)
+{
+    return _workspaces.size();
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Synthesizes the workspace's share of the frames of a block.  The output
+//   samples of the range are overwritten and whatever falls past the end of
+//   the range is kept for finishBlock().  Every workspace must be run, in
+//   any order or concurrently, before calling finishBlock().
+//
+// Parameters:
+//   channels - the channels to sum, each with numIn input samples
+//   numIn - the number of input samples in the block
+//   output - the output block, factor * numIn samples
+//   workspace - which range of the frames to synthesize
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void FftSynthesizer::run(const std::vector<Channel *> &channels, size_t numIn, Complex *output, size_t workspace)
+{
+    Workspace &ws = *_workspaces[workspace];
+    size_t numFrames = (numIn + _frameLength - 1) / _frameLength;
+    size_t firstFrame = numFrames * workspace / _workspaces.size();
+    size_t lastFrame = numFrames * (workspace + 1) / _workspaces.size();
+
+    size_t start = std::min(firstFrame * _frameLength, numIn) * _factor;
+    ws.end = std::min(lastFrame * _frameLength, numIn) * _factor;
+    ws.tail = Complex(0,0);
+
+    std::fill(output + start, output + ws.end, Complex(0,0));
+
+    for (size_t ff = firstFrame; ff < lastFrame; ++ff)
+    {
+        size_t frameStart = ff * _frameLength;
+        size_t count = std::min(_frameLength, numIn - frameStart);
+
+        synthesizeFrame(channels, frameStart, count, ws);
+
+        // Overlap-add the frame, its last tailSize samples reach into the next
+        size_t pos = frameStart * _factor;
+        size_t length = count * _factor + _tailSize;
+        size_t inRange = std::min(length, ws.end - pos);
+        const Complex *composite = &ws.composite[0];
+
+        for (size_t ii = 0; ii < inRange; ++ii)
+            output[pos + ii] += composite[ii];
+        for (size_t ii = inRange; ii < length; ++ii)
+            ws.tail[pos + ii - ws.end] += composite[ii];
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Sums one frame of every channel into the shared spectrum and transforms
+//   it back to the workspace's composite buffer.
+//
+// Parameters:
+//   channels - the channels to sum
+//   frameStart - index of the first input sample of the frame
+//   count - number of input samples in the frame
+//   ws - the workspace to use
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void FftSynthesizer::synthesizeFrame(const std::vector<Channel *> &channels, size_t frameStart, size_t count, Workspace &ws)
+{
+    size_t N = _outputFftSize;
+    Complex *spectrum = &ws.spectrum[0];
+    Complex *frame = &ws.frame[0];
+    const Complex *frameFreq = &ws.frameFreq[0];
+    size_t numBins = _bins.size();
+
+    std::fill(spectrum, spectrum + N, Complex(0,0));
+
+    for (size_t cc = 0; cc < channels.size(); ++cc)
+    {
+        const Channel &channel = *channels[cc];
+
+        // The whole bins of the shift are a rotation of the spectrum, the
+        // rest is applied to the input along with the carrier phase.  The
+        // input then sits a fraction of a bin off the prototype's response
+        // so the response is moved with it, to first order.
+        double bin = floor(channel.shift * N + 0.5);
+        double residual = channel.shift - bin / N;
+        Real fraction = Real(residual * N);
+        double cycles = channel.cycles + channel.shift * double(frameStart * _factor);
+        cycles -= floor(cycles);
+
+        std::complex<double> phasor = std::polar(1.0, 2.0 * M_PI * cycles);
+        std::complex<double> dphasor = std::polar(1.0, 2.0 * M_PI * residual * _factor);
+
+        const Complex *in = channel.input + frameStart;
+        for (size_t ii = 0; ii < count; ++ii)
+        {
+            frame[ii] = in[ii] * Complex(phasor);
+            phasor *= dphasor;
+        }
+        std::fill(frame + count, frame + _fftSize, Complex(0,0));
+
+        ws.fwd->run();
+
+        long rotate = long(bin) % long(N);
+        size_t offset = (rotate < 0) ? size_t(rotate + long(N)) : size_t(rotate);
+
+        for (size_t ii = 0; ii < numBins; ++ii)
+        {
+            size_t dest = _bins[ii] + offset;
+            if (dest >= N)
+                dest -= N;
+            spectrum[dest] += frameFreq[_sources[ii]] * (_response[ii] - fraction * _slope[ii]);
+        }
+    }
+
+    ws.rev->run();
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Completes a block once every workspace has been run.  The end of the
+//   last block and the overlaps between the ranges are added into the
+//   output, the end of this block is kept for the next and the phase of
+//   each channel is advanced.
+//
+// Parameters:
+//   channels - the channels passed to run()
+//   numIn - the number of input samples in the block
+//   output - the output block
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void FftSynthesizer::finishBlock(std::vector<Channel *> &channels, size_t numIn, Complex *output)
+{
+    size_t numOut = numIn * _factor;
+    ComplexArray carry(Complex(0,0), _tailSize);
+
+    // The previous block's overlap may be longer than a very short block
+    size_t inBlock = std::min(_tailSize, numOut);
+    for (size_t ii = 0; ii < inBlock; ++ii)
+        output[ii] += _carry[ii];
+    for (size_t ii = inBlock; ii < _tailSize; ++ii)
+        carry[ii - inBlock] = _carry[ii];
+
+    for (size_t ww = 0; ww < _workspaces.size(); ++ww)
+    {
+        const Workspace &ws = *_workspaces[ww];
+        for (size_t ii = 0; ii < _tailSize; ++ii)
+        {
+            size_t pos = ws.end + ii;
+            if (pos < numOut)
+                output[pos] += ws.tail[ii];
+            else
+                carry[pos - numOut] += ws.tail[ii];
+        }
+    }
+
+    _carry = carry;
+
+    for (size_t cc = 0; cc < channels.size(); ++cc)
+    {
+        Channel &channel = *channels[cc];
+        channel.cycles += channel.shift * double(numOut);
+        channel.cycles -= floor(channel.cycles);
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This method discards the overlap carried into the next block.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void FftSynthesizer::reset(void)
+{
+    _carry = Complex(0,0);
+
+    for (size_t ii = 0; ii < _workspaces.size(); ++ii)
+        _workspaces[ii]->tail = Complex(0,0);
+}
+
+
+size_t FftSynthesizer::factor(void)
+{
+    return _factor;
+}
+
+
+size_t FftSynthesizer::frameLength(void)
+{
+    return _frameLength;
+}
+
+
+size_t FftSynthesizer::numBins(void)
+{
+    return _bins.size();
+}
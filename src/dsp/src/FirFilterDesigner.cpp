@@ -59,7 +59,6 @@ size_t FirFilterDesigner::wdfir (
 		std::cout<<"FirFilterDesigner warning: fhNorm < 0"<<std::endl;
 		fhNorm = -1*fhNorm;
 	}
-	std::cout<<"desiging a real filter with properties type "<<type<<" ripple "<< ripple<< " twNorm = "<<twNorm<<" flNorm = "<<flNorm<<" fhNorm = "<<fhNorm<<std::endl;
     size_t ieo, nh;
     Real c, c1, c3, xn;
 
@@ -0,0 +1,686 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the FIR filtering kernels and the runtime selection
+//   of the kernels best suited to the CPU.
+//
+//   Because the taps are real, filtering interleaved complex samples is the
+//   same as filtering the interleaved floats with each tap applied to both the
+//   real and imaginary part.  The vector kernels therefore compute several
+//   consecutive outputs at once, broadcasting one tap at a time, which keeps
+//   the order of the additions for each output identical to the scalar loop.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <cstddef>
+#include "FirKernel.h"
+
+#ifdef KERNEL_SELECT_X86
+#  include <immintrin.h>
+#endif
+
+#ifdef KERNEL_SELECT_NEON
+#  include <arm_neon.h>
+#endif
+
+namespace FirKernel
+{
+
+typedef void (*filter_fn)(const Complex *, Complex *, size_t, const Real *, size_t);
+typedef void (*interpolate_fn)(const Complex *, Complex *, size_t, const Real *, size_t, size_t);
+typedef void (*decimate_fn)(const Complex *, Complex *, size_t, const Real *, size_t, size_t);
+
+struct kernel_set
+{
+    filter_fn filter;
+    interpolate_fn interpolate;
+    decimate_fn decimate;
+};
+
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Portable kernel, also used for the outputs left over by the vector
+//   kernels.
+//
+// Parameters:
+//   in - the input samples, count + numTaps - 1 of them
+//   out - the filtered samples
+//   count - the number of outputs
+//   taps - the filter coefficients
+//   numTaps - the number of filter coefficients
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static void filterScalar(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps)
+{
+    for (size_t ii = 0; ii < count; ++ii)
+    {
+        const Complex *ptrData = in + ii + numTaps - 1;
+        const Real *ptrCoef = taps;
+
+        Complex acc = *ptrCoef++ * *ptrData--;
+        for (size_t jj = 1; jj < numTaps; ++jj)
+            acc += *ptrCoef++ * *ptrData--;
+        out[ii] = acc;
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Portable interpolation kernel.  Each input produces the 2 * factor
+//   interleaved floats of its outputs in one pass, which the vector kernels
+//   split into register sized pieces.  firstFloat allows the vector kernels
+//   to hand over whatever is left of each row.
+//
+// Parameters:
+//   x - the newest input sample for this output
+//   o - the first output float for this input
+//   taps - the duplicated tap rows
+//   rowLength - 2 * factor
+//   tapsPerPhase - the number of tap rows
+//   firstFloat - the first float of each row to compute
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static inline void interpolateRowScalar(const float *x, float *o, const Real *taps,
+    size_t rowLength, size_t tapsPerPhase, size_t firstFloat)
+{
+    for (size_t ff = firstFloat; ff < rowLength; ++ff)
+    {
+        const float *ptrData = x + (ff & 1);
+        const Real *ptrCoef = taps + ff;
+
+        float acc = *ptrCoef * *ptrData;
+        for (size_t kk = 1; kk < tapsPerPhase; ++kk)
+        {
+            ptrData -= 2;
+            ptrCoef += rowLength;
+            acc += *ptrCoef * *ptrData;
+        }
+        o[ff] = acc;
+    }
+}
+
+static void interpolateScalar(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t factor, size_t tapsPerPhase)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t rowLength = 2 * factor;
+
+    for (size_t nn = 0; nn < count; ++nn)
+    {
+        interpolateRowScalar(inF + 2 * (nn + tapsPerPhase - 1), outF + nn * rowLength,
+            taps, rowLength, tapsPerPhase, 0);
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Portable decimation kernel.  The vector kernels gather the inputs of
+//   several kept outputs into one register, so each output still sums its
+//   taps in the scalar order.
+//
+// Parameters:
+//   in - the input samples, (count - 1) * factor + numTaps of them
+//   out - the kept filtered samples
+//   count - the number of outputs
+//   taps - the filter coefficients
+//   numTaps - the number of filter coefficients
+//   factor - the distance between kept outputs
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static void decimateScalar(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps, size_t factor)
+{
+    for (size_t ii = 0; ii < count; ++ii)
+    {
+        const Complex *ptrData = in + ii * factor + numTaps - 1;
+        const Real *ptrCoef = taps;
+
+        Complex acc = *ptrCoef++ * *ptrData--;
+        for (size_t jj = 1; jj < numTaps; ++jj)
+            acc += *ptrCoef++ * *ptrData--;
+        out[ii] = acc;
+    }
+}
+
+
+#ifdef KERNEL_SELECT_X86
+
+__attribute__((target("sse2")))
+static void filterSse2(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t ii = 0;
+
+    // 8 outputs per pass, four independent accumulators
+    for (; ii + 8 <= count; ii += 8)
+    {
+        const float *x = inF + 2 * (ii + numTaps - 1);
+        __m128 c = _mm_set1_ps(taps[0]);
+        __m128 a0 = _mm_mul_ps(c, _mm_loadu_ps(x));
+        __m128 a1 = _mm_mul_ps(c, _mm_loadu_ps(x + 4));
+        __m128 a2 = _mm_mul_ps(c, _mm_loadu_ps(x + 8));
+        __m128 a3 = _mm_mul_ps(c, _mm_loadu_ps(x + 12));
+        for (size_t jj = 1; jj < numTaps; ++jj)
+        {
+            x -= 2;
+            c = _mm_set1_ps(taps[jj]);
+            a0 = _mm_add_ps(a0, _mm_mul_ps(c, _mm_loadu_ps(x)));
+            a1 = _mm_add_ps(a1, _mm_mul_ps(c, _mm_loadu_ps(x + 4)));
+            a2 = _mm_add_ps(a2, _mm_mul_ps(c, _mm_loadu_ps(x + 8)));
+            a3 = _mm_add_ps(a3, _mm_mul_ps(c, _mm_loadu_ps(x + 12)));
+        }
+        _mm_storeu_ps(outF + 2 * ii, a0);
+        _mm_storeu_ps(outF + 2 * ii + 4, a1);
+        _mm_storeu_ps(outF + 2 * ii + 8, a2);
+        _mm_storeu_ps(outF + 2 * ii + 12, a3);
+    }
+
+    filterScalar(in + ii, out + ii, count - ii, taps, numTaps);
+}
+
+
+__attribute__((target("avx2")))
+static void filterAvx2(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t ii = 0;
+
+    // 16 outputs per pass, four independent accumulators
+    for (; ii + 16 <= count; ii += 16)
+    {
+        const float *x = inF + 2 * (ii + numTaps - 1);
+        __m256 c = _mm256_set1_ps(taps[0]);
+        __m256 a0 = _mm256_mul_ps(c, _mm256_loadu_ps(x));
+        __m256 a1 = _mm256_mul_ps(c, _mm256_loadu_ps(x + 8));
+        __m256 a2 = _mm256_mul_ps(c, _mm256_loadu_ps(x + 16));
+        __m256 a3 = _mm256_mul_ps(c, _mm256_loadu_ps(x + 24));
+        for (size_t jj = 1; jj < numTaps; ++jj)
+        {
+            x -= 2;
+            c = _mm256_set1_ps(taps[jj]);
+            a0 = _mm256_add_ps(a0, _mm256_mul_ps(c, _mm256_loadu_ps(x)));
+            a1 = _mm256_add_ps(a1, _mm256_mul_ps(c, _mm256_loadu_ps(x + 8)));
+            a2 = _mm256_add_ps(a2, _mm256_mul_ps(c, _mm256_loadu_ps(x + 16)));
+            a3 = _mm256_add_ps(a3, _mm256_mul_ps(c, _mm256_loadu_ps(x + 24)));
+        }
+        _mm256_storeu_ps(outF + 2 * ii, a0);
+        _mm256_storeu_ps(outF + 2 * ii + 8, a1);
+        _mm256_storeu_ps(outF + 2 * ii + 16, a2);
+        _mm256_storeu_ps(outF + 2 * ii + 24, a3);
+    }
+
+    filterScalar(in + ii, out + ii, count - ii, taps, numTaps);
+}
+
+// A complex sample is broadcast as a double so it lines up with the duplicated taps
+#define BROADCAST128(x) _mm_castpd_ps(_mm_load1_pd(reinterpret_cast<const double *>(x)))
+#define BROADCAST256(x) _mm256_castpd_ps(_mm256_broadcast_sd(reinterpret_cast<const double *>(x)))
+
+__attribute__((target("sse2")))
+static void interpolateSse2(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t factor, size_t tapsPerPhase)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t rowLength = 2 * factor;
+
+    for (size_t nn = 0; nn < count; ++nn)
+    {
+        const float *x = inF + 2 * (nn + tapsPerPhase - 1);
+        float *o = outF + nn * rowLength;
+        size_t ff = 0;
+
+        for (; ff + 4 <= rowLength; ff += 4)
+        {
+            const float *ptrData = x;
+            const Real *ptrCoef = taps + ff;
+            __m128 acc = _mm_mul_ps(_mm_loadu_ps(ptrCoef), BROADCAST128(ptrData));
+            for (size_t kk = 1; kk < tapsPerPhase; ++kk)
+            {
+                ptrData -= 2;
+                ptrCoef += rowLength;
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(ptrCoef), BROADCAST128(ptrData)));
+            }
+            _mm_storeu_ps(o + ff, acc);
+        }
+
+        interpolateRowScalar(x, o, taps, rowLength, tapsPerPhase, ff);
+    }
+}
+
+__attribute__((target("avx2")))
+static void interpolateAvx2(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t factor, size_t tapsPerPhase)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t rowLength = 2 * factor;
+
+    for (size_t nn = 0; nn < count; ++nn)
+    {
+        const float *x = inF + 2 * (nn + tapsPerPhase - 1);
+        float *o = outF + nn * rowLength;
+        size_t ff = 0;
+
+        for (; ff + 8 <= rowLength; ff += 8)
+        {
+            const float *ptrData = x;
+            const Real *ptrCoef = taps + ff;
+            __m256 acc = _mm256_mul_ps(_mm256_loadu_ps(ptrCoef), BROADCAST256(ptrData));
+            for (size_t kk = 1; kk < tapsPerPhase; ++kk)
+            {
+                ptrData -= 2;
+                ptrCoef += rowLength;
+                acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(ptrCoef), BROADCAST256(ptrData)));
+            }
+            _mm256_storeu_ps(o + ff, acc);
+        }
+
+        for (; ff + 4 <= rowLength; ff += 4)
+        {
+            const float *ptrData = x;
+            const Real *ptrCoef = taps + ff;
+            __m128 acc = _mm_mul_ps(_mm_loadu_ps(ptrCoef), BROADCAST128(ptrData));
+            for (size_t kk = 1; kk < tapsPerPhase; ++kk)
+            {
+                ptrData -= 2;
+                ptrCoef += rowLength;
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(ptrCoef), BROADCAST128(ptrData)));
+            }
+            _mm_storeu_ps(o + ff, acc);
+        }
+
+        interpolateRowScalar(x, o, taps, rowLength, tapsPerPhase, ff);
+    }
+}
+
+#undef BROADCAST128
+#undef BROADCAST256
+
+// Two complex samples, stride floats apart, in one register
+#define GATHER128(x, stride) _mm_castpd_ps(_mm_loadh_pd(_mm_load_sd(reinterpret_cast<const double *>(x)), \
+    reinterpret_cast<const double *>((x) + (stride))))
+// Four complex samples at the float offsets in index
+#define GATHER256(x, index) _mm256_castpd_ps(_mm256_i64gather_pd(reinterpret_cast<const double *>(x), index, 4))
+
+__attribute__((target("sse2")))
+static void decimateSse2(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps, size_t factor)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t stride = 2 * factor;
+    size_t ii = 0;
+
+    // 4 outputs per pass, two independent accumulators
+    for (; ii + 4 <= count; ii += 4)
+    {
+        const float *x = inF + 2 * (ii * factor + numTaps - 1);
+        __m128 c = _mm_set1_ps(taps[0]);
+        __m128 a0 = _mm_mul_ps(c, GATHER128(x, stride));
+        __m128 a1 = _mm_mul_ps(c, GATHER128(x + 2 * stride, stride));
+        for (size_t jj = 1; jj < numTaps; ++jj)
+        {
+            x -= 2;
+            c = _mm_set1_ps(taps[jj]);
+            a0 = _mm_add_ps(a0, _mm_mul_ps(c, GATHER128(x, stride)));
+            a1 = _mm_add_ps(a1, _mm_mul_ps(c, GATHER128(x + 2 * stride, stride)));
+        }
+        _mm_storeu_ps(outF + 2 * ii, a0);
+        _mm_storeu_ps(outF + 2 * ii + 4, a1);
+    }
+
+    decimateScalar(in + ii * factor, out + ii, count - ii, taps, numTaps, factor);
+}
+
+__attribute__((target("avx2")))
+static void decimateAvx2(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps, size_t factor)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t stride = 2 * factor;
+    size_t ii = 0;
+    __m256i index = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+
+    // 8 outputs per pass, two independent accumulators
+    for (; ii + 8 <= count; ii += 8)
+    {
+        const float *x = inF + 2 * (ii * factor + numTaps - 1);
+        __m256 c = _mm256_set1_ps(taps[0]);
+        __m256 a0 = _mm256_mul_ps(c, GATHER256(x, index));
+        __m256 a1 = _mm256_mul_ps(c, GATHER256(x + 4 * stride, index));
+        for (size_t jj = 1; jj < numTaps; ++jj)
+        {
+            x -= 2;
+            c = _mm256_set1_ps(taps[jj]);
+            a0 = _mm256_add_ps(a0, _mm256_mul_ps(c, GATHER256(x, index)));
+            a1 = _mm256_add_ps(a1, _mm256_mul_ps(c, GATHER256(x + 4 * stride, index)));
+        }
+        _mm256_storeu_ps(outF + 2 * ii, a0);
+        _mm256_storeu_ps(outF + 2 * ii + 8, a1);
+    }
+
+    decimateSse2(in + ii * factor, out + ii, count - ii, taps, numTaps, factor);
+}
+
+#undef GATHER128
+#undef GATHER256
+
+#endif // KERNEL_SELECT_X86
+
+
+#ifdef KERNEL_SELECT_AVX512
+
+// The unmasked AVX-512 intrinsics of some gcc releases seed their unused
+// pass-through operand with an undefined register, which -Wmaybe-uninitialized
+// reports.  The zero masking forms with every lane selected are the same
+// instructions seeded with zero, so they are used throughout.
+#define ALL8 ((__mmask8) 0xFF)
+#define ALL16 ((__mmask16) 0xFFFF)
+
+// The explicitly rounded forms are used so the compiler cannot contract the
+// multiply and add into an FMA, which is always available with AVX-512.
+#define MUL512(a, b) _mm512_maskz_mul_round_ps(ALL16, a, b, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define ADD512(a, b) _mm512_maskz_add_round_ps(ALL16, a, b, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+
+__attribute__((target("avx512f")))
+static void filterAvx512(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t ii = 0;
+
+    // 32 outputs per pass, four independent accumulators
+    for (; ii + 32 <= count; ii += 32)
+    {
+        const float *x = inF + 2 * (ii + numTaps - 1);
+        __m512 c = _mm512_set1_ps(taps[0]);
+        __m512 a0 = MUL512(c, _mm512_loadu_ps(x));
+        __m512 a1 = MUL512(c, _mm512_loadu_ps(x + 16));
+        __m512 a2 = MUL512(c, _mm512_loadu_ps(x + 32));
+        __m512 a3 = MUL512(c, _mm512_loadu_ps(x + 48));
+        for (size_t jj = 1; jj < numTaps; ++jj)
+        {
+            x -= 2;
+            c = _mm512_set1_ps(taps[jj]);
+            a0 = ADD512(a0, MUL512(c, _mm512_loadu_ps(x)));
+            a1 = ADD512(a1, MUL512(c, _mm512_loadu_ps(x + 16)));
+            a2 = ADD512(a2, MUL512(c, _mm512_loadu_ps(x + 32)));
+            a3 = ADD512(a3, MUL512(c, _mm512_loadu_ps(x + 48)));
+        }
+        _mm512_storeu_ps(outF + 2 * ii, a0);
+        _mm512_storeu_ps(outF + 2 * ii + 16, a1);
+        _mm512_storeu_ps(outF + 2 * ii + 32, a2);
+        _mm512_storeu_ps(outF + 2 * ii + 48, a3);
+    }
+
+    filterAvx2(in + ii, out + ii, count - ii, taps, numTaps);
+}
+
+#undef MUL512
+#undef ADD512
+#undef ALL8
+#undef ALL16
+
+#endif // KERNEL_SELECT_AVX512
+
+
+#ifdef KERNEL_SELECT_NEON
+
+static void filterNeon(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t ii = 0;
+
+    // 8 outputs per pass, four independent accumulators.  vmlaq is avoided
+    // as it may be fused on some cores.
+    for (; ii + 8 <= count; ii += 8)
+    {
+        const float *x = inF + 2 * (ii + numTaps - 1);
+        float32x4_t a0 = vmulq_n_f32(vld1q_f32(x), taps[0]);
+        float32x4_t a1 = vmulq_n_f32(vld1q_f32(x + 4), taps[0]);
+        float32x4_t a2 = vmulq_n_f32(vld1q_f32(x + 8), taps[0]);
+        float32x4_t a3 = vmulq_n_f32(vld1q_f32(x + 12), taps[0]);
+        for (size_t jj = 1; jj < numTaps; ++jj)
+        {
+            x -= 2;
+            a0 = vaddq_f32(a0, vmulq_n_f32(vld1q_f32(x), taps[jj]));
+            a1 = vaddq_f32(a1, vmulq_n_f32(vld1q_f32(x + 4), taps[jj]));
+            a2 = vaddq_f32(a2, vmulq_n_f32(vld1q_f32(x + 8), taps[jj]));
+            a3 = vaddq_f32(a3, vmulq_n_f32(vld1q_f32(x + 12), taps[jj]));
+        }
+        vst1q_f32(outF + 2 * ii, a0);
+        vst1q_f32(outF + 2 * ii + 4, a1);
+        vst1q_f32(outF + 2 * ii + 8, a2);
+        vst1q_f32(outF + 2 * ii + 12, a3);
+    }
+
+    filterScalar(in + ii, out + ii, count - ii, taps, numTaps);
+}
+
+static void interpolateNeon(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t factor, size_t tapsPerPhase)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t rowLength = 2 * factor;
+
+    for (size_t nn = 0; nn < count; ++nn)
+    {
+        const float *x = inF + 2 * (nn + tapsPerPhase - 1);
+        float *o = outF + nn * rowLength;
+        size_t ff = 0;
+
+        for (; ff + 4 <= rowLength; ff += 4)
+        {
+            const float *ptrData = x;
+            const Real *ptrCoef = taps + ff;
+            float32x2_t sample = vld1_f32(ptrData);
+            float32x4_t acc = vmulq_f32(vld1q_f32(ptrCoef), vcombine_f32(sample, sample));
+            for (size_t kk = 1; kk < tapsPerPhase; ++kk)
+            {
+                ptrData -= 2;
+                ptrCoef += rowLength;
+                sample = vld1_f32(ptrData);
+                acc = vaddq_f32(acc, vmulq_f32(vld1q_f32(ptrCoef), vcombine_f32(sample, sample)));
+            }
+            vst1q_f32(o + ff, acc);
+        }
+
+        interpolateRowScalar(x, o, taps, rowLength, tapsPerPhase, ff);
+    }
+}
+
+static inline float32x4_t gatherNeon(const float *x, size_t stride)
+{
+    return vcombine_f32(vld1_f32(x), vld1_f32(x + stride));
+}
+
+static void decimateNeon(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps, size_t factor)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    size_t stride = 2 * factor;
+    size_t ii = 0;
+
+    // 4 outputs per pass, two independent accumulators
+    for (; ii + 4 <= count; ii += 4)
+    {
+        const float *x = inF + 2 * (ii * factor + numTaps - 1);
+        float32x4_t a0 = vmulq_n_f32(gatherNeon(x, stride), taps[0]);
+        float32x4_t a1 = vmulq_n_f32(gatherNeon(x + 2 * stride, stride), taps[0]);
+        for (size_t jj = 1; jj < numTaps; ++jj)
+        {
+            x -= 2;
+            a0 = vaddq_f32(a0, vmulq_n_f32(gatherNeon(x, stride), taps[jj]));
+            a1 = vaddq_f32(a1, vmulq_n_f32(gatherNeon(x + 2 * stride, stride), taps[jj]));
+        }
+        vst1q_f32(outF + 2 * ii, a0);
+        vst1q_f32(outF + 2 * ii + 4, a1);
+    }
+
+    decimateScalar(in + ii * factor, out + ii, count - ii, taps, numTaps, factor);
+}
+
+#endif // KERNEL_SELECT_NEON
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Returns the kernels for the given type.  All are NULL if the type is
+//   not supported by this CPU and compiler.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static kernel_set lookup(KernelSelect::kernel_type type)
+{
+    kernel_set kernels = { NULL, NULL, NULL };
+
+    if (!KernelSelect::supported(type))
+        return kernels;
+
+    switch (type)
+    {
+    case KernelSelect::scalar:
+        kernels.filter = filterScalar;
+        kernels.interpolate = interpolateScalar;
+        kernels.decimate = decimateScalar;
+        break;
+#ifdef KERNEL_SELECT_X86
+    case KernelSelect::sse2:
+        kernels.filter = filterSse2;
+        kernels.interpolate = interpolateSse2;
+        kernels.decimate = decimateSse2;
+        break;
+    case KernelSelect::avx2:
+        kernels.filter = filterAvx2;
+        kernels.interpolate = interpolateAvx2;
+        kernels.decimate = decimateAvx2;
+        break;
+#endif
+#ifdef KERNEL_SELECT_AVX512
+    case KernelSelect::avx512:
+        // A row of interpolator outputs is too short and the decimator is bound by
+        // its gathers, so neither gains from the wider registers.
+        kernels.filter = filterAvx512;
+        kernels.interpolate = interpolateAvx2;
+        kernels.decimate = decimateAvx2;
+        break;
+#endif
+#ifdef KERNEL_SELECT_NEON
+    case KernelSelect::neon:
+        kernels.filter = filterNeon;
+        kernels.interpolate = interpolateNeon;
+        kernels.decimate = decimateNeon;
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return kernels;
+}
+
+static KernelSelect::kernel_type currentType = KernelSelect::best();
+static kernel_set currentKernels = lookup(currentType);
+
+
+void filter(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps)
+{
+    if (count == 0 || numTaps == 0)
+        return;
+
+    currentKernels.filter(in, out, count, taps, numTaps);
+}
+
+void interpolate(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t factor, size_t tapsPerPhase)
+{
+    if (count == 0 || factor == 0 || tapsPerPhase == 0)
+        return;
+
+    currentKernels.interpolate(in, out, count, taps, factor, tapsPerPhase);
+}
+
+void decimate(const Complex *in, Complex *out, size_t count,
+    const Real *taps, size_t numTaps, size_t factor)
+{
+    if (count == 0 || numTaps == 0 || factor == 0)
+        return;
+
+    // Without decimation the contiguous loads of the filter kernel are faster
+    if (factor == 1)
+        currentKernels.filter(in, out, count, taps, numTaps);
+    else
+        currentKernels.decimate(in, out, count, taps, numTaps, factor);
+}
+
+bool select(KernelSelect::kernel_type type)
+{
+    if (type == KernelSelect::automatic)
+        type = KernelSelect::best();
+
+    kernel_set kernels = lookup(type);
+    if (kernels.filter == NULL)
+        return false;
+
+    currentType = type;
+    currentKernels = kernels;
+    return true;
+}
+
+KernelSelect::kernel_type selected(void)
+{
+    return currentType;
+}
+
+} // namespace FirKernel
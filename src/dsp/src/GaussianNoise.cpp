@@ -0,0 +1,150 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the GaussianNoise class implementation.
+//
+//   Counter c of the generator gives the four words of samples 2c and
+//   2c + 1.  The words are generated a chunk at a time on the stack, so the
+//   noise is added in a single pass over the data.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <algorithm>
+#include "GaussianNoise.h"
+#include "SignalKernel.h"
+
+// Samples generated per pass, even so the chunks start on a counter
+static const size_t NOISE_CHUNK = 512;
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   GaussianNoise's constructor.  The stream starts at sample zero.
+//
+// Parameters:
+//   seed - the key of the generator.  Streams with different seeds are
+//       independent.
+//   sigma - the standard deviation of the real and imaginary parts
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+GaussianNoise::GaussianNoise(uint64_t seed, Real sigma) :
+    _seed(seed),
+    _sigma(sigma),
+    _position(0)
+{
+}
+
+GaussianNoise::~GaussianNoise(void)
+{
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Adds the next count samples of the stream to the data and advances the
+//   position past them.
+//
+// Parameters:
+//   data - the samples to add the noise to
+//   count - the number of samples
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void GaussianNoise::add(Complex *data, size_t count)
+{
+    add(data, count, _position);
+    _position += count;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Adds samples first to first + count - 1 of the stream to the data
+//   without moving the position.  Safe to call from several threads at
+//   once.
+//
+// Parameters:
+//   data - the samples to add the noise to
+//   count - the number of samples
+//   first - the stream index of the first sample
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void GaussianNoise::add(Complex *data, size_t count, uint64_t first) const
+{
+    uint32_t words[2 * NOISE_CHUNK];
+    uint64_t counter = first / 2;
+    // An odd first sample is the second half of its counter
+    size_t skip = first % 2;
+
+    while (count > 0)
+    {
+        size_t num = std::min(count, NOISE_CHUNK - skip);
+        SignalKernel::philox(counter, _seed, words, (skip + num + 1) / 2);
+        SignalKernel::gaussian(words + 2 * skip, data, num, _sigma, true);
+        counter += (skip + num) / 2;
+        data += num;
+        count -= num;
+        skip = 0;
+    }
+}
+
+void GaussianNoise::setSeed(uint64_t seed)
+{
+    _seed = seed;
+}
+
+uint64_t GaussianNoise::seed(void) const
+{
+    return _seed;
+}
+
+void GaussianNoise::setSigma(Real sigma)
+{
+    _sigma = sigma;
+}
+
+Real GaussianNoise::sigma(void) const
+{
+    return _sigma;
+}
+
+void GaussianNoise::seek(uint64_t position)
+{
+    _position = position;
+}
+
+uint64_t GaussianNoise::position(void) const
+{
+    return _position;
+}
@@ -0,0 +1,193 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the HalfbandDecimator class implementation.
+//
+//   With numTaps = 2c + 1, kept sample i is the sum of taps[j] times
+//   input[2i + 2c - j].  The nonzero taps other than the center are those
+//   with j = s + 2k, s being the parity of c + 1, and they meet the inputs
+//   2(i + c - s - k) + s, which are sample i + c - s - k of the inputs of
+//   parity s.  The number of such taps is c + 1 - s, so after gathering the
+//   inputs of parity s a plain FIR filter over them gives the sum.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <cmath>
+#include <stdexcept>
+#include "HalfbandDecimator.h"
+#include "FirFilterDesigner.h"
+#include "FirKernel.h"
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   HalfbandDecimator's constructor.
+//
+// Parameters:
+//   taps - a halfband filter from design(), an odd number of taps with
+//       every other tap either side of the center zero
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+HalfbandDecimator::HalfbandDecimator(const RealArray &taps) :
+    PolyphaseDecimator(2, taps)
+{
+    // Validate parameters
+    if( taps.size() % 2 == 0 )
+        throw std::invalid_argument( "A halfband filter must have an odd number of taps" );
+
+    _center = taps.size() / 2;
+    _oddStart = (_center + 1) % 2;
+
+    for (size_t jj = 1 - _oddStart; jj < taps.size(); jj += 2)
+    {
+        if (jj != _center && taps[jj] != 0)
+            throw std::invalid_argument( "Every other tap of a halfband filter must be zero" );
+    }
+
+    _oddTaps.resize(_center + 1 - _oddStart);
+    for (size_t kk = 0; kk < _oddTaps.size(); ++kk)
+        _oddTaps[kk] = taps[_oddStart + 2 * kk];
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   HalfbandDecimator's destructor.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+HalfbandDecimator::~HalfbandDecimator(void)
+{
+    //
+    // Hook
+    //
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   The filter taps evaluated for each output sample, the center tap and
+//   the taps at odd distances from it.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   The number of multiplies per output sample.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t HalfbandDecimator::multipliesPerOutput(void)
+{
+    return _oddTaps.size() + 1;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Designs a Kaiser windowed halfband lowpass.  The window is sized by
+//   KaiserWindowDesigner for the ripple and transition width, rounded up
+//   to an odd length and to at least three taps.  The taps at even
+//   distances from the center are set to exactly zero.
+//
+// Parameters:
+//   taps - receives the filter coefficients
+//   ripple - the stopband ripple as a fraction of the passband gain
+//   twNorm - the transition width as a fraction of the input rate
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void HalfbandDecimator::design(RealArray &taps, Real ripple, Real twNorm)
+{
+    KaiserWindowDesigner kaiser(ripple, twNorm);
+    size_t size = kaiser.getWindowSize() | 1;
+    if (size < 3)
+        size = 3;
+    kaiser.overrideSize(size);
+
+    RealArray window;
+    kaiser.getWindow(window);
+
+    // The ideal response at a quarter of the rate is sin(pi d / 2) / (pi d)
+    // at distance d from the center, and one half at the center.
+    size_t center = size / 2;
+    taps.resize(size);
+    taps[center] = 0.5 * window[center];
+    for (size_t dd = 1; dd <= center; ++dd)
+    {
+        Real ideal = (dd % 2) ? ((dd % 4 == 1) ? 1.0 : -1.0) / (M_PI * dd) : 0.0;
+        taps[center - dd] = ideal * window[center - dd];
+        taps[center + dd] = ideal * window[center + dd];
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Computes count kept samples from the inputs starting at in, as
+//   PolyphaseDecimator::decimate, without the zero taps.
+//
+// Parameters:
+//   in - the first input of the first kept sample
+//   out - receives the kept samples
+//   count - the number of kept samples
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void HalfbandDecimator::decimate(const Complex *in, Complex *out, size_t count)
+{
+    if (count == 0)
+        return;
+
+    // The buffer only grows, so blocks of a steady size do not allocate
+    size_t numGathered = count + _oddTaps.size() - 1;
+    if (_gathered.size() < numGathered)
+        _gathered.resize(numGathered);
+
+    for (size_t mm = 0; mm < numGathered; ++mm)
+        _gathered[mm] = in[2 * mm + _oddStart];
+
+    FirKernel::filter(&_gathered[0], out, count, &_oddTaps[0], _oddTaps.size());
+
+    Real centerTap = _taps[_center];
+    for (size_t ii = 0; ii < count; ++ii)
+        out[ii] += centerTap * in[2 * ii + _center];
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the check of the instruction sets supported by the
+//   CPU, shared by the FIR and signal kernels.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <cstddef>
+#include "KernelSelect.h"
+
+namespace KernelSelect
+{
+
+bool supported(kernel_type type)
+{
+#ifdef KERNEL_SELECT_X86
+    __builtin_cpu_init();
+#endif
+
+    switch (type)
+    {
+    case scalar:
+        return true;
+#ifdef KERNEL_SELECT_X86
+    case sse2:
+        return __builtin_cpu_supports("sse2");
+    case avx2:
+        return __builtin_cpu_supports("avx2");
+#endif
+#ifdef KERNEL_SELECT_AVX512
+    case avx512:
+        // The AVX-512 kernels fall back to the AVX2 ones where the wider
+        // registers do not help
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2");
+#endif
+#ifdef KERNEL_SELECT_NEON
+    case neon:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+kernel_type best(void)
+{
+    const kernel_type preference[] = { avx512, avx2, sse2, neon };
+
+    for (size_t ii = 0; ii < sizeof(preference) / sizeof(preference[0]); ++ii)
+    {
+        if (supported(preference[ii]))
+            return preference[ii];
+    }
+
+    return scalar;
+}
+
+const char *name(kernel_type type)
+{
+    switch (type)
+    {
+    case automatic: return "automatic";
+    case scalar:    return "scalar";
+    case sse2:      return "sse2";
+    case avx2:      return "avx2";
+    case avx512:    return "avx512";
+    case neon:      return "neon";
+    }
+    return "unknown";
+}
+
+} // namespace KernelSelect
@@ -0,0 +1,354 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the MultistageDecimator class implementation.
+//
+//   All frequencies below are relative to the final output sample rate, so a
+//   stage whose output is R times the final rate has its aliases fold back
+//   around multiples of R.  The early stages only have to keep aliases out
+//   of the output band, -1/2 to 1/2, leaving the last stage to shape it.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "MultistageDecimator.h"
+#include "HalfbandDecimator.h"
+#include "FirFilterDesigner.h"
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   MultistageDecimator's constructor.  Factors the decimation and designs
+//   the filter for each stage.
+//
+// Parameters:
+//   factor - the overall decimation factor
+//   passband - the edge of the band to keep flat, as a fraction of the
+//       output sample rate.  Must be less than 0.5.
+//   attenuation - the stopband attenuation of every stage in dB
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+MultistageDecimator::MultistageDecimator(size_t factor, Real passband, Real attenuation) :
+    _factor(factor),
+    _noiseGain(1.0),
+    _noiseBandwidth(1.0)
+{
+    // Validate parameters
+    if( factor == 0 )
+        throw std::invalid_argument( "Decimation factor must be at least 1" );
+    if( passband <= 0 || passband >= 0.5 )
+        throw std::invalid_argument( "Passband must be between 0 and half the output rate" );
+
+    // Prime factors, largest first.  The early stages cost about the same
+    // whatever their factor, while the sharp last stage costs the least with
+    // the smallest factor, so the factors of two end the cascade.
+    std::vector<size_t> stageFactors;
+    size_t remaining = factor;
+    for (size_t pp = 2; pp * pp <= remaining; ++pp)
+    {
+        while (remaining % pp == 0)
+        {
+            stageFactors.push_back(pp);
+            remaining /= pp;
+        }
+    }
+    if (remaining > 1)
+        stageFactors.push_back(remaining);
+    std::reverse(stageFactors.begin(), stageFactors.end());
+
+    Real ripple = pow(10.0, -attenuation / 20.0);
+    FirFilterDesigner designer;
+
+    // Sample rate at the input of each stage, relative to the output
+    Real inRate = factor;
+
+    // Impulse response of the stages so far at the input rate, and the
+    // number of input samples per sample of the next stage
+    std::vector<double> response(1, 1.0);
+    size_t spacing = 1;
+
+    for (size_t ii = 0; ii < stageFactors.size(); ++ii)
+    {
+        Real outRate = inRate / stageFactors[ii];
+        Real passEdge, stopEdge;
+        bool halfband = false;
+
+        if (ii + 1 < stageFactors.size())
+        {
+            // Anything above outRate - 1/2 folds outside the output band,
+            // where the later stages remove it.  The band is symmetric about
+            // half the stage's output rate, so a factor of two is a halfband.
+            halfband = (stageFactors[ii] == 2);
+            passEdge = 0.5;
+            stopEdge = outRate - 0.5;
+        }
+        else
+        {
+            // The shaping filter, nothing may fold into the output band
+            passEdge = passband;
+            stopEdge = 0.5;
+        }
+
+        // Normalized to this stage's input rate
+        Real twNorm = (stopEdge - passEdge) / inRate;
+        Real cutoffNorm = 0.5 * (stopEdge + passEdge) / inRate;
+
+        RealArray taps;
+        if (halfband)
+        {
+            HalfbandDecimator::design(taps, ripple, twNorm);
+            _stages.push_back(new HalfbandDecimator(taps));
+        }
+        else
+        {
+            designer.wdfir(taps, FIRFilter::lowpass, ripple, twNorm, cutoffNorm);
+            _stages.push_back(new PolyphaseDecimator(stageFactors[ii], taps));
+        }
+        inRate = outRate;
+
+        // The stage's taps are spacing input samples apart
+        std::vector<double> cascade(response.size() + (taps.size() - 1) * spacing, 0.0);
+        for (size_t jj = 0; jj < taps.size(); ++jj)
+        {
+            for (size_t kk = 0; kk < response.size(); ++kk)
+                cascade[jj * spacing + kk] += taps[jj] * response[kk];
+        }
+        response.swap(cascade);
+        spacing *= stageFactors[ii];
+    }
+
+    double energy = 0.0;
+    double dcGain = 0.0;
+    for (size_t ii = 0; ii < response.size(); ++ii)
+    {
+        energy += response[ii] * response[ii];
+        dcGain += response[ii];
+    }
+    _noiseGain = energy;
+    _noiseBandwidth = factor * energy / (dcGain * dcGain);
+
+    if (_stages.size() > 1)
+        _buffers.resize(_stages.size() - 1);
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   MultistageDecimator's destructor.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+MultistageDecimator::~MultistageDecimator(void)
+{
+    for (size_t ii = 0; ii < _stages.size(); ++ii)
+        delete _stages[ii];
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   The number of samples the next call to run() will produce from an input
+//   of the given size.
+//
+// Parameters:
+//   inputSize - the number of input samples
+//
+// Return Value:
+//   The number of output samples.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t MultistageDecimator::outputSize(size_t inputSize) const
+{
+    size_t size = inputSize;
+    for (size_t ii = 0; ii < _stages.size(); ++ii)
+        size = _stages[ii]->outputSize(size);
+    return size;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Runs the input through every stage, continuing from the previous block.
+//   The output must have room for outputSize(input.size()) samples.
+//
+// Parameters:
+//   input - the samples to decimate
+//   output - receives the decimated samples
+//
+// Return Value:
+//   The number of samples written to output.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t MultistageDecimator::run(const ComplexArray &input, Complex *output)
+{
+    size_t numIn = input.size();
+
+    if (numIn == 0)
+        return 0;
+
+    if (_stages.empty())
+    {
+        for (size_t ii = 0; ii < numIn; ++ii)
+            output[ii] = input[ii];
+        return numIn;
+    }
+
+    const Complex *in = &input[0];
+    size_t last = _stages.size() - 1;
+
+    for (size_t ii = 0; ii < last; ++ii)
+    {
+        // The buffers only grow, the stage output varies by a sample between blocks
+        ComplexArray &buffer = _buffers[ii];
+        size_t numOut = _stages[ii]->outputSize(numIn);
+        if (buffer.size() < numOut)
+            buffer.resize(numOut);
+
+        Complex *out = (numOut > 0) ? &buffer[0] : NULL;
+        numIn = _stages[ii]->run(in, numIn, out);
+        in = out;
+    }
+
+    return _stages[last]->run(in, numIn, output);
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Clears the history of every stage.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void MultistageDecimator::reset(void)
+{
+    for (size_t ii = 0; ii < _stages.size(); ++ii)
+        _stages[ii]->reset();
+}
+
+
+size_t MultistageDecimator::factor(void)
+{
+    return _factor;
+}
+
+
+size_t MultistageDecimator::numStages(void)
+{
+    return _stages.size();
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   The filter taps evaluated across all stages for each output sample, a
+//   measure of the cost of the cascade.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   The number of multiplies per output sample.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t MultistageDecimator::multipliesPerOutput(void)
+{
+    size_t multiplies = 0;
+    size_t outputsPerOutput = 1;
+
+    for (size_t ii = _stages.size(); ii > 0; --ii)
+    {
+        multiplies += _stages[ii - 1]->multipliesPerOutput() * outputsPerOutput;
+        outputsPerOutput *= _stages[ii - 1]->factor();
+    }
+
+    return multiplies;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   The power gain of the cascade for white noise, the sum of the squares of
+//   its impulse response at the input rate.  White noise of variance v at
+//   the input leaves the cascade with variance v * noiseGain(), which is
+//   the noise equivalent bandwidth of the cascade as a fraction of the input
+//   rate when its gain at DC is one.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   The ratio of the output to the input noise power.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+Real MultistageDecimator::noiseGain(void)
+{
+    return _noiseGain;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   The noise equivalent bandwidth of the cascade, the width of the ideal
+//   filter with the cascade's gain at DC that passes the same noise power.
+//   Slightly less than one as the transition band rolls off below the
+//   passband gain.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   The bandwidth as a fraction of the output sample rate.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+Real MultistageDecimator::noiseBandwidth(void)
+{
+    return _noiseBandwidth;
+}
@@ -0,0 +1,267 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the PolyphaseDecimator class implementation.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <stdexcept>
+#include "PolyphaseDecimator.h"
+#include "FirKernel.h"
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   PolyphaseDecimator's constructor.
+//
+// Parameters:
+//   factor - the decimation factor
+//   taps - the low pass filter coefficients at the input sample rate
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+PolyphaseDecimator::PolyphaseDecimator(size_t factor, const RealArray &taps) :
+    _factor(factor)
+{
+    // Validate parameters
+    if( factor == 0 )
+        throw std::invalid_argument( "Decimation factor must be at least 1" );
+    if( taps.size() == 0 )
+        throw std::invalid_argument( "Empty filter coefficients" );
+
+    _taps.resize(taps.size());
+    _taps = taps;
+    _hist.resize(_taps.size() - 1);
+
+    reset();
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   PolyphaseDecimator's destructor.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+PolyphaseDecimator::~PolyphaseDecimator(void)
+{
+    //
+    // Hook
+    //
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   The number of samples the next call to run() will produce from an input
+//   of the given size.  This depends on the puncture index left by the
+//   previous block.
+//
+// Parameters:
+//   inputSize - the number of input samples
+//
+// Return Value:
+//   The number of output samples.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t PolyphaseDecimator::outputSize(size_t inputSize) const
+{
+    if (inputSize <= _pi)
+        return 0;
+
+    return (inputSize - _pi + _factor - 1) / _factor;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Filters and decimates the input, continuing from the previous block.
+//   The output must have room for outputSize(input.size()) samples.
+//
+//   Kept samples within numTaps - 1 of the start of the block need inputs
+//   from the previous block so they are filtered from a short buffer joining
+//   the two, the rest are filtered straight from the input.
+//
+// Parameters:
+//   input - the samples to decimate
+//   output - receives the kept samples
+//
+// Return Value:
+//   The number of samples written to output.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t PolyphaseDecimator::run(const ComplexArray &input, Complex *output)
+{
+    if (input.size() == 0)
+        return 0;
+
+    return run(&input[0], input.size(), output);
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   As above, for numIn samples that are not held in a ComplexArray.
+//
+// Parameters:
+//   input - the samples to decimate
+//   numIn - the number of input samples
+//   output - receives the kept samples
+//
+// Return Value:
+//   The number of samples written to output.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t PolyphaseDecimator::run(const Complex *input, size_t numIn, Complex *output)
+{
+    size_t numHist = _hist.size();
+    size_t numOut = outputSize(numIn);
+
+    if (numIn == 0)
+        return 0;
+
+    // Kept samples whose filter reaches back into the previous block
+    size_t numStitched = (numIn < numHist) ? numIn : numHist;
+    size_t numEarly = (numStitched > _pi) ? (numStitched - _pi + _factor - 1) / _factor : 0;
+
+    if (numHist > 0)
+    {
+        for (size_t ii = 0; ii < numHist; ++ii)
+            _stitch[ii] = _hist[ii];
+        for (size_t ii = 0; ii < numStitched; ++ii)
+            _stitch[numHist + ii] = input[ii];
+
+        if (numEarly > 0)
+            decimate(&_stitch[_pi], output, numEarly);
+    }
+
+    if (numOut > numEarly)
+    {
+        size_t first = _pi + numEarly * _factor;
+        decimate(input + first - numHist, output + numEarly, numOut - numEarly);
+    }
+
+    // Keep the newest inputs for the next block
+    if (numHist > 0)
+    {
+        for (size_t ii = 0; ii < numHist; ++ii)
+            _hist[ii] = _stitch[numStitched + ii];
+        for (size_t ii = numHist - numStitched; ii < numHist; ++ii)
+            _hist[ii] = input[numIn - numHist + ii];
+    }
+
+    // RHWEB-117 - The kept samples continue across the block boundary
+    // rather than restarting at the first sample of the next block.
+    _pi = _pi + numOut * _factor - numIn;
+
+    return numOut;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This method zeroes out the filter's history buffer and restarts the
+//   decimation so the last of every factor inputs is kept.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void PolyphaseDecimator::reset(void)
+{
+    _hist = Complex(0,0);
+    _stitch.resize(2 * _hist.size(), Complex(0,0));
+    _pi = _factor - 1;
+}
+
+
+size_t PolyphaseDecimator::factor(void)
+{
+    return _factor;
+}
+
+
+size_t PolyphaseDecimator::numTaps(void)
+{
+    return _taps.size();
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   The filter taps evaluated for each output sample.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   The number of multiplies per output sample.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+size_t PolyphaseDecimator::multipliesPerOutput(void)
+{
+    return _taps.size();
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Computes count kept samples, the first of them from the numTaps inputs
+//   starting at in and each following one from the inputs factor later.
+//
+// Parameters:
+//   in - the first input of the first kept sample
+//   out - receives the kept samples
+//   count - the number of kept samples
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void PolyphaseDecimator::decimate(const Complex *in, Complex *out, size_t count)
+{
+    FirKernel::decimate(in, out, count, &_taps[0], _taps.size(), _factor);
+}
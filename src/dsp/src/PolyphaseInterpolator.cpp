@@ -0,0 +1,192 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the PolyphaseInterpolator class implementation.  See
+//   section 3.4 of http://www.dspguru.com/dsp/faqs/multirate/interpolation
+//   for the approach.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <stdexcept>
+#include "PolyphaseInterpolator.h"
+#include "FirKernel.h"
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   PolyphaseInterpolator's constructor.
+//
+// Parameters:
+//   input - reference to input vector
+//   output - reference to output vector, resized to factor times the input
+//   factor - the interpolation factor
+//   prototype - the low pass filter coefficients at the output sample rate.
+//       Coefficient i belongs to phase i % factor.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+PolyphaseInterpolator::PolyphaseInterpolator(
+    const ComplexArray &input, ComplexArray &output,
+    size_t factor, const RealArray &prototype) :
+    vIn(input),
+    vOut(output),
+    _factor(factor)
+{
+    // Validate parameters
+    if( factor == 0 )
+        throw std::invalid_argument( "Interpolation factor must be at least 1" );
+    if( prototype.size() == 0 )
+        throw std::invalid_argument( "Empty filter coefficients" );
+
+    _tapsPerPhase = (prototype.size() + factor - 1) / factor;
+
+    // Row k holds coefficient p + factor * k of every phase p, twice, with
+    // zeros where the prototype does not divide evenly into the phases.
+    size_t rowLength = 2 * _factor;
+    _taps.resize(_tapsPerPhase * rowLength, Real(0));
+    for (size_t ii = 0; ii < prototype.size(); ++ii)
+    {
+        size_t phase = ii % _factor;
+        size_t row = ii / _factor;
+        _taps[row * rowLength + 2 * phase] = prototype[ii];
+        _taps[row * rowLength + 2 * phase + 1] = prototype[ii];
+    }
+
+    _hist.resize(_tapsPerPhase - 1);
+    vOut.resize(vIn.size() * _factor);
+
+    reset();
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   PolyphaseInterpolator's destructor.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+PolyphaseInterpolator::~PolyphaseInterpolator(void)
+{
+    //
+    // Hook
+    //
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Interpolates the input into the output, continuing from the previous
+//   block.  The output is resized if the input size has changed.
+//
+//   The first tapsPerPhase - 1 inputs need samples from the previous block
+//   so they are filtered from a short buffer joining the two, the rest are
+//   filtered straight from the input.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void PolyphaseInterpolator::run(void)
+{
+    size_t numIn = vIn.size();
+    size_t numHist = _hist.size();
+
+    if (vOut.size() != numIn * _factor)
+        vOut.resize(numIn * _factor);
+
+    if (numIn == 0)
+        return;
+
+    const Real *taps = &_taps[0];
+    size_t numStitched = (numIn < numHist) ? numIn : numHist;
+
+    if (numHist > 0)
+    {
+        for (size_t ii = 0; ii < numHist; ++ii)
+            _stitch[ii] = _hist[ii];
+        for (size_t ii = 0; ii < numStitched; ++ii)
+            _stitch[numHist + ii] = vIn[ii];
+
+        FirKernel::interpolate(&_stitch[0], &vOut[0], numStitched, taps, _factor, _tapsPerPhase);
+    }
+
+    if (numIn > numStitched)
+    {
+        FirKernel::interpolate(&vIn[0], &vOut[numStitched * _factor], numIn - numStitched,
+            taps, _factor, _tapsPerPhase);
+    }
+
+    // Keep the newest inputs for the next block
+    if (numHist > 0)
+    {
+        for (size_t ii = 0; ii < numHist; ++ii)
+            _hist[ii] = _stitch[numStitched + ii];
+        for (size_t ii = numHist - numStitched; ii < numHist; ++ii)
+            _hist[ii] = vIn[numIn - numHist + ii];
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This method zeroes out the filter's history buffer.
+//
+// Parameters:
+//   None.
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void PolyphaseInterpolator::reset(void)
+{
+    _hist = Complex(0,0);
+    _stitch.resize(2 * _hist.size(), Complex(0,0));
+}
+
+
+size_t PolyphaseInterpolator::factor(void)
+{
+    return _factor;
+}
+
+
+size_t PolyphaseInterpolator::tapsPerPhase(void)
+{
+    return _tapsPerPhase;
+}
@@ -0,0 +1,1195 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file distributed with this
+ * source distribution.
+ *
+ * This file is part of REDHAWK Basic Components dsp library.
+ *
+ * REDHAWK Basic Components dsp library is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * REDHAWK Basic Components dsp library is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with this
+ * program.  If not, see http://www.gnu.org/licenses/.
+ */
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   This file contains the oscillator, phasor and random number kernels and
+//   the runtime selection of the kernels best suited to the CPU.
+//
+//   Every vector kernel performs the operations of the scalar kernel in the
+//   same order, lane by lane, and none of them fuse a multiply and add, so
+//   the output does not depend on the kernel chosen.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+#include <cmath>
+#include <cstring>
+#include "SignalKernel.h"
+
+#ifdef KERNEL_SELECT_X86
+#  include <immintrin.h>
+#endif
+
+#ifdef KERNEL_SELECT_NEON
+#  include <arm_neon.h>
+#endif
+
+namespace SignalKernel
+{
+
+typedef void (*rotate_fn)(const Complex *, Complex *, size_t, const Complex *, Complex, bool);
+typedef void (*sincos_fn)(const uint32_t *, Complex *, size_t);
+typedef void (*philox_fn)(uint64_t, uint64_t, uint32_t *, size_t);
+typedef void (*gaussian_fn)(const uint32_t *, Complex *, size_t, Real, bool);
+
+struct kernel_set
+{
+    rotate_fn rotate;
+    sincos_fn sincos;
+    philox_fn philox;
+    gaussian_fn gaussian;
+};
+
+// Radians per count of a fixed point phase
+static const float PHASE_SCALE = 1.4629180792671596e-09f;
+
+// Minimax coefficients of sin and cos over a quarter cycle centered on zero
+static const float SIN_C3 = -1.6666654611e-1f;
+static const float SIN_C5 = 8.3321608736e-3f;
+static const float SIN_C7 = -1.9515295891e-4f;
+static const float COS_C4 = 4.166664568298827e-2f;
+static const float COS_C6 = -1.388731625493765e-3f;
+static const float COS_C8 = 2.443315711809948e-5f;
+
+// Philox4x32 multipliers, key increments and number of rounds
+static const uint32_t PHILOX_M0 = 0xD2511F53u;
+static const uint32_t PHILOX_M1 = 0xCD9E8D57u;
+static const uint32_t PHILOX_W0 = 0x9E3779B9u;
+static const uint32_t PHILOX_W1 = 0xBB67AE85u;
+static const int PHILOX_ROUNDS = 10;
+
+// A uniform variate is the top 23 bits of a word with a one appended, so
+// it is an odd number of 2^-24 steps and strictly between zero and one
+static const float UNIFORM_SCALE = 5.9604644775390625e-08f;
+
+// Coefficients of the logarithm of 1 + x for sqrt(1/2) <= 1 + x < sqrt(2),
+// from Cephes, with ln 2 split in two to add the exponent exactly
+static const float SQRT_2 = 1.41421356f;
+static const float LOG_P0 = 7.0376836292e-2f;
+static const float LOG_P1 = -1.1514610310e-1f;
+static const float LOG_P2 = 1.1676998740e-1f;
+static const float LOG_P3 = -1.2420140846e-1f;
+static const float LOG_P4 = 1.4249322787e-1f;
+static const float LOG_P5 = -1.6668057665e-1f;
+static const float LOG_P6 = 2.0000714765e-1f;
+static const float LOG_P7 = -2.4999993993e-1f;
+static const float LOG_P8 = 3.3333331174e-1f;
+static const float LN2_LO = -2.12194440e-4f;
+static const float LN2_HI = 0.693359375f;
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Portable oscillator kernel.  The complex products are written out so
+//   the vector kernels can match the order of every operation, and the
+//   ROTATE_LANES phasors are independent so the compiler is free to
+//   vectorize them too.  rotateRowScalar handles the samples left over by
+//   the vector kernels with the lanes as they stand.
+//
+// Parameters:
+//   x - the input floats
+//   o - the output floats
+//   count - the number of samples
+//   p - the interleaved lane phasors
+//   accumulate - add to the output rather than overwriting it
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static inline void rotateRowScalar(const float *x, float *o, size_t count,
+    const float *p, bool accumulate)
+{
+    for (size_t kk = 0; kk < count; ++kk)
+    {
+        float re = x[2 * kk] * p[2 * kk] - x[2 * kk + 1] * p[2 * kk + 1];
+        float im = x[2 * kk + 1] * p[2 * kk] + x[2 * kk] * p[2 * kk + 1];
+        if (accumulate)
+        {
+            o[2 * kk] += re;
+            o[2 * kk + 1] += im;
+        }
+        else
+        {
+            o[2 * kk] = re;
+            o[2 * kk + 1] = im;
+        }
+    }
+}
+
+static void rotateScalar(const Complex *in, Complex *out, size_t count,
+    const Complex *phasors, Complex step, bool accumulate)
+{
+    const float *x = reinterpret_cast<const float *>(in);
+    float *o = reinterpret_cast<float *>(out);
+    float p[2 * ROTATE_LANES];
+    float sr = step.real();
+    float si = step.imag();
+    size_t ii = 0;
+
+    for (size_t kk = 0; kk < ROTATE_LANES; ++kk)
+    {
+        p[2 * kk] = phasors[kk].real();
+        p[2 * kk + 1] = phasors[kk].imag();
+    }
+
+    for (; ii + ROTATE_LANES <= count; ii += ROTATE_LANES)
+    {
+        rotateRowScalar(x + 2 * ii, o + 2 * ii, ROTATE_LANES, p, accumulate);
+
+        for (size_t kk = 0; kk < ROTATE_LANES; ++kk)
+        {
+            float re = p[2 * kk] * sr - p[2 * kk + 1] * si;
+            float im = p[2 * kk + 1] * sr + p[2 * kk] * si;
+            p[2 * kk] = re;
+            p[2 * kk + 1] = im;
+        }
+    }
+
+    rotateRowScalar(x + 2 * ii, o + 2 * ii, count - ii, p, accumulate);
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Portable phasor kernel.  The phase is split into the nearest quarter
+//   cycle q and a remainder within an eighth of a cycle of it.  sin and cos
+//   of the remainder come from short polynomials and are then swapped and
+//   negated for the quarter.  The vector kernels follow the same steps.
+//
+// Parameters:
+//   phases - the fixed point phases, 2^32 counts per cycle
+//   out - the phasors
+//   count - the number of phases
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static inline void sincosScalar(uint32_t phase, float &c, float &s)
+{
+    uint32_t q = (phase + 0x20000000u) >> 30;
+    float x = (float) (int32_t) (phase - (q << 30)) * PHASE_SCALE;
+    float x2 = x * x;
+    float sx = x + x * x2 * (SIN_C3 + x2 * (SIN_C5 + x2 * SIN_C7));
+    float cx = 1.0f + x2 * (-0.5f + x2 * (COS_C4 + x2 * (COS_C6 + x2 * COS_C8)));
+    float sq = (q & 1) ? cx : sx;
+    float cq = (q & 1) ? sx : cx;
+    c = ((q + 1) & 2) ? -cq : cq;
+    s = (q & 2) ? -sq : sq;
+}
+
+static void sincosScalar(const uint32_t *phases, Complex *out, size_t count)
+{
+    float *o = reinterpret_cast<float *>(out);
+
+    for (size_t ii = 0; ii < count; ++ii)
+    {
+        sincosScalar(phases[ii], o[2 * ii], o[2 * ii + 1]);
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Portable Philox4x32-10 kernel.  Each round multiplies two of the words
+//   into 64 bit products and mixes their halves with the other two words
+//   and the round's key.  The vector kernels run the same rounds on several
+//   counters side by side.
+//
+// Parameters:
+//   counter - the first counter
+//   key - the key
+//   words - the random words, four per counter
+//   count - the number of counters
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static void philoxScalar(uint64_t counter, uint64_t key, uint32_t *words, size_t count)
+{
+    for (size_t ii = 0; ii < count; ++ii)
+    {
+        uint64_t c = counter + ii;
+        uint32_t x0 = (uint32_t) c;
+        uint32_t x1 = (uint32_t) (c >> 32);
+        uint32_t x2 = 0;
+        uint32_t x3 = 0;
+        uint32_t k0 = (uint32_t) key;
+        uint32_t k1 = (uint32_t) (key >> 32);
+
+        for (int rr = 0; rr < PHILOX_ROUNDS; ++rr)
+        {
+            uint64_t p0 = (uint64_t) PHILOX_M0 * x0;
+            uint64_t p1 = (uint64_t) PHILOX_M1 * x2;
+            x0 = (uint32_t) (p1 >> 32) ^ x1 ^ k0;
+            x1 = (uint32_t) p1;
+            x2 = (uint32_t) (p0 >> 32) ^ x3 ^ k1;
+            x3 = (uint32_t) p0;
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+
+        words[4 * ii] = x0;
+        words[4 * ii + 1] = x1;
+        words[4 * ii + 2] = x2;
+        words[4 * ii + 3] = x3;
+    }
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Portable Box-Muller kernel.  The uniform variate is split into its
+//   exponent and a mantissa within a factor of sqrt(2) of one, whose
+//   logarithm comes from a polynomial.  The vector kernels follow the same
+//   steps.
+//
+// Parameters:
+//   words - the random words, two per sample
+//   out - the Gaussian samples
+//   count - the number of samples
+//   sigma - the standard deviation of the real and imaginary parts
+//   accumulate - add the samples to out rather than writing them
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static inline float magnitudeScalar(uint32_t word, float sigma)
+{
+    float u = (float) (int32_t) ((word >> 8) | 1) * UNIFORM_SCALE;
+    uint32_t bits;
+    memcpy(&bits, &u, sizeof(bits));
+    float e = (float) ((int32_t) (bits >> 23) - 127);
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m;
+    memcpy(&m, &bits, sizeof(m));
+    if (m > SQRT_2)
+    {
+        m = m * 0.5f;
+        e = e + 1.0f;
+    }
+    float x = m - 1.0f;
+    float x2 = x * x;
+    float p = LOG_P0;
+    p = p * x + LOG_P1;
+    p = p * x + LOG_P2;
+    p = p * x + LOG_P3;
+    p = p * x + LOG_P4;
+    p = p * x + LOG_P5;
+    p = p * x + LOG_P6;
+    p = p * x + LOG_P7;
+    p = p * x + LOG_P8;
+    float y = p * x * x2;
+    y = y + LN2_LO * e;
+    y = y - 0.5f * x2;
+    float logU = x + y;
+    logU = logU + LN2_HI * e;
+    return sigma * std::sqrt(-2.0f * logU);
+}
+
+static void gaussianScalar(const uint32_t *words, Complex *out, size_t count, Real sigma,
+    bool accumulate)
+{
+    float *o = reinterpret_cast<float *>(out);
+
+    for (size_t ii = 0; ii < count; ++ii)
+    {
+        float r = magnitudeScalar(words[2 * ii], sigma);
+        float c, s;
+        sincosScalar(words[2 * ii + 1], c, s);
+        if (accumulate)
+        {
+            o[2 * ii] += r * c;
+            o[2 * ii + 1] += r * s;
+        }
+        else
+        {
+            o[2 * ii] = r * c;
+            o[2 * ii + 1] = r * s;
+        }
+    }
+}
+
+
+#ifdef KERNEL_SELECT_X86
+
+// Complex products of interleaved samples, x * p with the real and imaginary
+// parts of p already duplicated into pre and pim.  The imaginary part is
+// formed as xi * pr + xr * pi and the real part as xr * pr - xi * pi, as in
+// rotateRowScalar.
+__attribute__((target("sse2")))
+static inline __m128 cmulSse2(__m128 x, __m128 pre, __m128 pim)
+{
+    const __m128 sign = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    __m128 t1 = _mm_mul_ps(x, pre);
+    __m128 t2 = _mm_mul_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1)), pim);
+    return _mm_add_ps(t1, _mm_xor_ps(t2, sign));
+}
+
+__attribute__((target("sse2")))
+static void rotateSse2(const Complex *in, Complex *out, size_t count,
+    const Complex *phasors, Complex step, bool accumulate)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    const float *ph = reinterpret_cast<const float *>(phasors);
+    __m128 sr = _mm_set1_ps(step.real());
+    __m128 si = _mm_set1_ps(step.imag());
+    __m128 lane[4];
+    size_t ii = 0;
+
+    for (size_t rr = 0; rr < 4; ++rr)
+        lane[rr] = _mm_loadu_ps(ph + 4 * rr);
+
+    // ROTATE_LANES samples per pass, two in each register
+    for (; ii + ROTATE_LANES <= count; ii += ROTATE_LANES)
+    {
+        for (size_t rr = 0; rr < 4; ++rr)
+        {
+            const float *x = inF + 2 * ii + 4 * rr;
+            float *o = outF + 2 * ii + 4 * rr;
+            __m128 pre = _mm_shuffle_ps(lane[rr], lane[rr], _MM_SHUFFLE(2, 2, 0, 0));
+            __m128 pim = _mm_shuffle_ps(lane[rr], lane[rr], _MM_SHUFFLE(3, 3, 1, 1));
+            __m128 y = cmulSse2(_mm_loadu_ps(x), pre, pim);
+            if (accumulate)
+                y = _mm_add_ps(_mm_loadu_ps(o), y);
+            _mm_storeu_ps(o, y);
+            lane[rr] = cmulSse2(lane[rr], sr, si);
+        }
+    }
+
+    float p[2 * ROTATE_LANES];
+    for (size_t rr = 0; rr < 4; ++rr)
+        _mm_storeu_ps(p + 4 * rr, lane[rr]);
+    rotateRowScalar(inF + 2 * ii, outF + 2 * ii, count - ii, p, accumulate);
+}
+
+// Phasors of four phases, in the order of sincosScalar.  The quarter's sign
+// flips are its bits moved up to the sign bit.
+__attribute__((target("sse2")))
+static inline void sincosSse2(__m128i ph, __m128 &c, __m128 &s)
+{
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    __m128i q = _mm_srli_epi32(_mm_add_epi32(ph, _mm_set1_epi32(0x20000000)), 30);
+    __m128 x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(ph, _mm_slli_epi32(q, 30))), _mm_set1_ps(PHASE_SCALE));
+    __m128 x2 = _mm_mul_ps(x, x);
+    __m128 ps = _mm_add_ps(_mm_set1_ps(SIN_C5), _mm_mul_ps(x2, _mm_set1_ps(SIN_C7)));
+    ps = _mm_add_ps(_mm_set1_ps(SIN_C3), _mm_mul_ps(x2, ps));
+    __m128 sx = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, x2), ps));
+    __m128 pc = _mm_add_ps(_mm_set1_ps(COS_C6), _mm_mul_ps(x2, _mm_set1_ps(COS_C8)));
+    pc = _mm_add_ps(_mm_set1_ps(COS_C4), _mm_mul_ps(x2, pc));
+    pc = _mm_add_ps(_mm_set1_ps(-0.5f), _mm_mul_ps(x2, pc));
+    __m128 cx = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, pc));
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+    __m128 sq = _mm_or_ps(_mm_and_ps(swap, cx), _mm_andnot_ps(swap, sx));
+    __m128 cq = _mm_or_ps(_mm_and_ps(swap, sx), _mm_andnot_ps(swap, cx));
+    s = _mm_xor_ps(sq, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30)));
+    c = _mm_xor_ps(cq, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30)));
+}
+
+__attribute__((target("sse2")))
+static void sincosSse2(const uint32_t *phases, Complex *out, size_t count)
+{
+    float *o = reinterpret_cast<float *>(out);
+    size_t ii = 0;
+
+    for (; ii + 4 <= count; ii += 4)
+    {
+        __m128 c, s;
+        sincosSse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(phases + ii)), c, s);
+        _mm_storeu_ps(o + 2 * ii, _mm_unpacklo_ps(c, s));
+        _mm_storeu_ps(o + 2 * ii + 4, _mm_unpackhi_ps(c, s));
+    }
+
+    sincosScalar(phases + ii, out + ii, count - ii);
+}
+
+// The 32 bit halves of the 64 bit products of four pairs of words.  The
+// multiply only takes the even words so the odd ones are shifted down.
+__attribute__((target("sse2")))
+static inline void mulhiloSse2(__m128i a, __m128i b, __m128i &hi, __m128i &lo)
+{
+    const __m128i even = _mm_set_epi32(0, -1, 0, -1);
+    __m128i pe = _mm_mul_epu32(a, b);
+    __m128i po = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    lo = _mm_or_si128(_mm_and_si128(pe, even), _mm_slli_epi64(po, 32));
+    hi = _mm_or_si128(_mm_srli_epi64(pe, 32), _mm_andnot_si128(even, po));
+}
+
+__attribute__((target("sse2")))
+static void philoxSse2(uint64_t counter, uint64_t key, uint32_t *words, size_t count)
+{
+    const __m128i m0 = _mm_set1_epi32(PHILOX_M0);
+    const __m128i m1 = _mm_set1_epi32(PHILOX_M1);
+    size_t ii = 0;
+
+    // Four counters per pass, one in each lane
+    for (; ii + 4 <= count; ii += 4)
+    {
+        uint64_t c = counter + ii;
+        __m128i x0 = _mm_set_epi32((uint32_t) (c + 3), (uint32_t) (c + 2), (uint32_t) (c + 1), (uint32_t) c);
+        __m128i x1 = _mm_set_epi32((uint32_t) ((c + 3) >> 32), (uint32_t) ((c + 2) >> 32),
+            (uint32_t) ((c + 1) >> 32), (uint32_t) (c >> 32));
+        __m128i x2 = _mm_setzero_si128();
+        __m128i x3 = _mm_setzero_si128();
+        __m128i k0 = _mm_set1_epi32((uint32_t) key);
+        __m128i k1 = _mm_set1_epi32((uint32_t) (key >> 32));
+
+        for (int rr = 0; rr < PHILOX_ROUNDS; ++rr)
+        {
+            __m128i hi0, lo0, hi1, lo1;
+            mulhiloSse2(x0, m0, hi0, lo0);
+            mulhiloSse2(x2, m1, hi1, lo1);
+            x0 = _mm_xor_si128(_mm_xor_si128(hi1, x1), k0);
+            x1 = lo1;
+            x2 = _mm_xor_si128(_mm_xor_si128(hi0, x3), k1);
+            x3 = lo0;
+            k0 = _mm_add_epi32(k0, _mm_set1_epi32(PHILOX_W0));
+            k1 = _mm_add_epi32(k1, _mm_set1_epi32(PHILOX_W1));
+        }
+
+        // Transpose so each counter's four words are together
+        __m128i t0 = _mm_unpacklo_epi32(x0, x1);
+        __m128i t1 = _mm_unpacklo_epi32(x2, x3);
+        __m128i t2 = _mm_unpackhi_epi32(x0, x1);
+        __m128i t3 = _mm_unpackhi_epi32(x2, x3);
+        __m128i *w = reinterpret_cast<__m128i *>(words + 4 * ii);
+        _mm_storeu_si128(w, _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128(w + 1, _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128(w + 2, _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128(w + 3, _mm_unpackhi_epi64(t2, t3));
+    }
+
+    philoxScalar(counter + ii, key, words + 4 * ii, count - ii);
+}
+
+// Box-Muller magnitudes of four words, in the order of magnitudeScalar
+__attribute__((target("sse2")))
+static inline __m128 magnitudeSse2(__m128i word, __m128 sigma)
+{
+    __m128 u = _mm_mul_ps(_mm_cvtepi32_ps(_mm_or_si128(_mm_srli_epi32(word, 8), _mm_set1_epi32(1))),
+        _mm_set1_ps(UNIFORM_SCALE));
+    __m128i bits = _mm_castps_si128(u);
+    __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)),
+        _mm_set1_epi32(0x3F800000)));
+    __m128 big = _mm_cmpgt_ps(m, _mm_set1_ps(SQRT_2));
+    m = _mm_or_ps(_mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))), _mm_andnot_ps(big, m));
+    e = _mm_or_ps(_mm_and_ps(big, _mm_add_ps(e, _mm_set1_ps(1.0f))), _mm_andnot_ps(big, e));
+    __m128 x = _mm_sub_ps(m, _mm_set1_ps(1.0f));
+    __m128 x2 = _mm_mul_ps(x, x);
+    __m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(LOG_P0), x), _mm_set1_ps(LOG_P1));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(LOG_P2));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(LOG_P3));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(LOG_P4));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(LOG_P5));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(LOG_P6));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(LOG_P7));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(LOG_P8));
+    __m128 y = _mm_mul_ps(_mm_mul_ps(p, x), x2);
+    y = _mm_add_ps(y, _mm_mul_ps(_mm_set1_ps(LN2_LO), e));
+    y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), x2));
+    __m128 logU = _mm_add_ps(x, y);
+    logU = _mm_add_ps(logU, _mm_mul_ps(_mm_set1_ps(LN2_HI), e));
+    return _mm_mul_ps(sigma, _mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), logU)));
+}
+
+__attribute__((target("sse2")))
+static void gaussianSse2(const uint32_t *words, Complex *out, size_t count, Real sigma,
+    bool accumulate)
+{
+    float *o = reinterpret_cast<float *>(out);
+    const __m128 sig = _mm_set1_ps(sigma);
+    size_t ii = 0;
+
+    for (; ii + 4 <= count; ii += 4)
+    {
+        // Split the pairs into magnitude and phase words
+        __m128 a = _mm_loadu_ps(reinterpret_cast<const float *>(words + 2 * ii));
+        __m128 b = _mm_loadu_ps(reinterpret_cast<const float *>(words + 2 * ii + 4));
+        __m128 r = magnitudeSse2(_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))), sig);
+        __m128 c, s;
+        sincosSse2(_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))), c, s);
+        c = _mm_mul_ps(r, c);
+        s = _mm_mul_ps(r, s);
+        __m128 y0 = _mm_unpacklo_ps(c, s);
+        __m128 y1 = _mm_unpackhi_ps(c, s);
+        if (accumulate)
+        {
+            y0 = _mm_add_ps(_mm_loadu_ps(o + 2 * ii), y0);
+            y1 = _mm_add_ps(_mm_loadu_ps(o + 2 * ii + 4), y1);
+        }
+        _mm_storeu_ps(o + 2 * ii, y0);
+        _mm_storeu_ps(o + 2 * ii + 4, y1);
+    }
+
+    gaussianScalar(words + 2 * ii, out + ii, count - ii, sigma, accumulate);
+}
+
+
+__attribute__((target("avx2")))
+static inline __m256 cmulAvx2(__m256 x, __m256 pre, __m256 pim)
+{
+    __m256 t1 = _mm256_mul_ps(x, pre);
+    __m256 t2 = _mm256_mul_ps(_mm256_permute_ps(x, _MM_SHUFFLE(2, 3, 0, 1)), pim);
+    return _mm256_addsub_ps(t1, t2);
+}
+
+__attribute__((target("avx2")))
+static void rotateAvx2(const Complex *in, Complex *out, size_t count,
+    const Complex *phasors, Complex step, bool accumulate)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    const float *ph = reinterpret_cast<const float *>(phasors);
+    __m256 sr = _mm256_set1_ps(step.real());
+    __m256 si = _mm256_set1_ps(step.imag());
+    __m256 lane0 = _mm256_loadu_ps(ph);
+    __m256 lane1 = _mm256_loadu_ps(ph + 8);
+    size_t ii = 0;
+
+    // ROTATE_LANES samples per pass, four in each register
+    for (; ii + ROTATE_LANES <= count; ii += ROTATE_LANES)
+    {
+        const float *x = inF + 2 * ii;
+        float *o = outF + 2 * ii;
+        __m256 y0 = cmulAvx2(_mm256_loadu_ps(x), _mm256_moveldup_ps(lane0), _mm256_movehdup_ps(lane0));
+        __m256 y1 = cmulAvx2(_mm256_loadu_ps(x + 8), _mm256_moveldup_ps(lane1), _mm256_movehdup_ps(lane1));
+        if (accumulate)
+        {
+            y0 = _mm256_add_ps(_mm256_loadu_ps(o), y0);
+            y1 = _mm256_add_ps(_mm256_loadu_ps(o + 8), y1);
+        }
+        _mm256_storeu_ps(o, y0);
+        _mm256_storeu_ps(o + 8, y1);
+        lane0 = cmulAvx2(lane0, sr, si);
+        lane1 = cmulAvx2(lane1, sr, si);
+    }
+
+    float p[2 * ROTATE_LANES];
+    _mm256_storeu_ps(p, lane0);
+    _mm256_storeu_ps(p + 8, lane1);
+    rotateRowScalar(inF + 2 * ii, outF + 2 * ii, count - ii, p, accumulate);
+}
+
+__attribute__((target("avx2")))
+static inline void sincosAvx2(__m256i ph, __m256 &c, __m256 &s)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+    __m256i q = _mm256_srli_epi32(_mm256_add_epi32(ph, _mm256_set1_epi32(0x20000000)), 30);
+    __m256 x = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(ph, _mm256_slli_epi32(q, 30))), _mm256_set1_ps(PHASE_SCALE));
+    __m256 x2 = _mm256_mul_ps(x, x);
+    __m256 ps = _mm256_add_ps(_mm256_set1_ps(SIN_C5), _mm256_mul_ps(x2, _mm256_set1_ps(SIN_C7)));
+    ps = _mm256_add_ps(_mm256_set1_ps(SIN_C3), _mm256_mul_ps(x2, ps));
+    __m256 sx = _mm256_add_ps(x, _mm256_mul_ps(_mm256_mul_ps(x, x2), ps));
+    __m256 pc = _mm256_add_ps(_mm256_set1_ps(COS_C6), _mm256_mul_ps(x2, _mm256_set1_ps(COS_C8)));
+    pc = _mm256_add_ps(_mm256_set1_ps(COS_C4), _mm256_mul_ps(x2, pc));
+    pc = _mm256_add_ps(_mm256_set1_ps(-0.5f), _mm256_mul_ps(x2, pc));
+    __m256 cx = _mm256_add_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(x2, pc));
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+    __m256 sq = _mm256_blendv_ps(sx, cx, swap);
+    __m256 cq = _mm256_blendv_ps(cx, sx, swap);
+    s = _mm256_xor_ps(sq, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30)));
+    c = _mm256_xor_ps(cq, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, one), two), 30)));
+}
+
+__attribute__((target("avx2")))
+static void sincosAvx2(const uint32_t *phases, Complex *out, size_t count)
+{
+    float *o = reinterpret_cast<float *>(out);
+    size_t ii = 0;
+
+    for (; ii + 8 <= count; ii += 8)
+    {
+        __m256 c, s;
+        sincosAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(phases + ii)), c, s);
+        // unpack works within the 128 bit halves, so the halves are swapped back into order
+        __m256 lo = _mm256_unpacklo_ps(c, s);
+        __m256 hi = _mm256_unpackhi_ps(c, s);
+        _mm256_storeu_ps(o + 2 * ii, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(o + 2 * ii + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    sincosScalar(phases + ii, out + ii, count - ii);
+}
+
+// The 32 bit halves of the 64 bit products of eight pairs of words, as
+// mulhiloSse2
+__attribute__((target("avx2")))
+static inline void mulhiloAvx2(__m256i a, __m256i b, __m256i &hi, __m256i &lo)
+{
+    __m256i pe = _mm256_mul_epu32(a, b);
+    __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    lo = _mm256_blend_epi32(pe, _mm256_slli_epi64(po, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(pe, 32), po, 0xAA);
+}
+
+__attribute__((target("avx2")))
+static void philoxAvx2(uint64_t counter, uint64_t key, uint32_t *words, size_t count)
+{
+    const __m256i m0 = _mm256_set1_epi32(PHILOX_M0);
+    const __m256i m1 = _mm256_set1_epi32(PHILOX_M1);
+    size_t ii = 0;
+
+    // Eight counters per pass, one in each lane
+    for (; ii + 8 <= count; ii += 8)
+    {
+        uint32_t lo[8], hi[8];
+        for (size_t ll = 0; ll < 8; ++ll)
+        {
+            uint64_t c = counter + ii + ll;
+            lo[ll] = (uint32_t) c;
+            hi[ll] = (uint32_t) (c >> 32);
+        }
+        __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lo));
+        __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hi));
+        __m256i x2 = _mm256_setzero_si256();
+        __m256i x3 = _mm256_setzero_si256();
+        __m256i k0 = _mm256_set1_epi32((uint32_t) key);
+        __m256i k1 = _mm256_set1_epi32((uint32_t) (key >> 32));
+
+        for (int rr = 0; rr < PHILOX_ROUNDS; ++rr)
+        {
+            __m256i hi0, lo0, hi1, lo1;
+            mulhiloAvx2(x0, m0, hi0, lo0);
+            mulhiloAvx2(x2, m1, hi1, lo1);
+            x0 = _mm256_xor_si256(_mm256_xor_si256(hi1, x1), k0);
+            x1 = lo1;
+            x2 = _mm256_xor_si256(_mm256_xor_si256(hi0, x3), k1);
+            x3 = lo0;
+            k0 = _mm256_add_epi32(k0, _mm256_set1_epi32(PHILOX_W0));
+            k1 = _mm256_add_epi32(k1, _mm256_set1_epi32(PHILOX_W1));
+        }
+
+        // Transpose within the 128 bit halves, which leaves counters n and
+        // n + 4 in the same register, then swap the halves into order
+        __m256i t0 = _mm256_unpacklo_epi32(x0, x1);
+        __m256i t1 = _mm256_unpacklo_epi32(x2, x3);
+        __m256i t2 = _mm256_unpackhi_epi32(x0, x1);
+        __m256i t3 = _mm256_unpackhi_epi32(x2, x3);
+        __m256i c0 = _mm256_unpacklo_epi64(t0, t1);
+        __m256i c1 = _mm256_unpackhi_epi64(t0, t1);
+        __m256i c2 = _mm256_unpacklo_epi64(t2, t3);
+        __m256i c3 = _mm256_unpackhi_epi64(t2, t3);
+        __m256i *w = reinterpret_cast<__m256i *>(words + 4 * ii);
+        _mm256_storeu_si256(w, _mm256_permute2x128_si256(c0, c1, 0x20));
+        _mm256_storeu_si256(w + 1, _mm256_permute2x128_si256(c2, c3, 0x20));
+        _mm256_storeu_si256(w + 2, _mm256_permute2x128_si256(c0, c1, 0x31));
+        _mm256_storeu_si256(w + 3, _mm256_permute2x128_si256(c2, c3, 0x31));
+    }
+
+    philoxScalar(counter + ii, key, words + 4 * ii, count - ii);
+}
+
+// Box-Muller magnitudes of eight words, in the order of magnitudeScalar
+__attribute__((target("avx2")))
+static inline __m256 magnitudeAvx2(__m256i word, __m256 sigma)
+{
+    __m256 u = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_or_si256(_mm256_srli_epi32(word, 8), _mm256_set1_epi32(1))),
+        _mm256_set1_ps(UNIFORM_SCALE));
+    __m256i bits = _mm256_castps_si256(u);
+    __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)),
+        _mm256_set1_epi32(0x3F800000)));
+    __m256 big = _mm256_cmp_ps(m, _mm256_set1_ps(SQRT_2), _CMP_GT_OQ);
+    m = _mm256_blendv_ps(m, _mm256_mul_ps(m, _mm256_set1_ps(0.5f)), big);
+    e = _mm256_blendv_ps(e, _mm256_add_ps(e, _mm256_set1_ps(1.0f)), big);
+    __m256 x = _mm256_sub_ps(m, _mm256_set1_ps(1.0f));
+    __m256 x2 = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(LOG_P0), x), _mm256_set1_ps(LOG_P1));
+    p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(LOG_P2));
+    p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(LOG_P3));
+    p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(LOG_P4));
+    p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(LOG_P5));
+    p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(LOG_P6));
+    p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(LOG_P7));
+    p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(LOG_P8));
+    __m256 y = _mm256_mul_ps(_mm256_mul_ps(p, x), x2);
+    y = _mm256_add_ps(y, _mm256_mul_ps(_mm256_set1_ps(LN2_LO), e));
+    y = _mm256_sub_ps(y, _mm256_mul_ps(_mm256_set1_ps(0.5f), x2));
+    __m256 logU = _mm256_add_ps(x, y);
+    logU = _mm256_add_ps(logU, _mm256_mul_ps(_mm256_set1_ps(LN2_HI), e));
+    return _mm256_mul_ps(sigma, _mm256_sqrt_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), logU)));
+}
+
+__attribute__((target("avx2")))
+static void gaussianAvx2(const uint32_t *words, Complex *out, size_t count, Real sigma,
+    bool accumulate)
+{
+    float *o = reinterpret_cast<float *>(out);
+    const __m256 sig = _mm256_set1_ps(sigma);
+    size_t ii = 0;
+
+    for (; ii + 8 <= count; ii += 8)
+    {
+        // Split the pairs into magnitude and phase words.  The shuffle works
+        // within the 128 bit halves so the 64 bit quarters are put back in order.
+        __m256 a = _mm256_loadu_ps(reinterpret_cast<const float *>(words + 2 * ii));
+        __m256 b = _mm256_loadu_ps(reinterpret_cast<const float *>(words + 2 * ii + 8));
+        __m256i mw = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))),
+            _MM_SHUFFLE(3, 1, 2, 0));
+        __m256i pw = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))),
+            _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 r = magnitudeAvx2(mw, sig);
+        __m256 c, s;
+        sincosAvx2(pw, c, s);
+        c = _mm256_mul_ps(r, c);
+        s = _mm256_mul_ps(r, s);
+        __m256 lo = _mm256_unpacklo_ps(c, s);
+        __m256 hi = _mm256_unpackhi_ps(c, s);
+        __m256 y0 = _mm256_permute2f128_ps(lo, hi, 0x20);
+        __m256 y1 = _mm256_permute2f128_ps(lo, hi, 0x31);
+        if (accumulate)
+        {
+            y0 = _mm256_add_ps(_mm256_loadu_ps(o + 2 * ii), y0);
+            y1 = _mm256_add_ps(_mm256_loadu_ps(o + 2 * ii + 8), y1);
+        }
+        _mm256_storeu_ps(o + 2 * ii, y0);
+        _mm256_storeu_ps(o + 2 * ii + 8, y1);
+    }
+
+    gaussianScalar(words + 2 * ii, out + ii, count - ii, sigma, accumulate);
+}
+
+#endif // KERNEL_SELECT_X86
+
+
+#ifdef KERNEL_SELECT_AVX512
+
+// The unmasked AVX-512 intrinsics of some gcc releases seed their unused
+// pass-through operand with an undefined register, which -Wmaybe-uninitialized
+// reports.  The zero masking forms with every lane selected are the same
+// instructions seeded with zero, so they are used throughout.
+#define ALL8 ((__mmask8) 0xFF)
+#define ALL16 ((__mmask16) 0xFFFF)
+
+// The 32 bit halves of the 64 bit products of sixteen pairs of words, as
+// mulhiloSse2
+__attribute__((target("avx512f")))
+static inline void mulhiloAvx512(__m512i a, __m512i b, __m512i &hi, __m512i &lo)
+{
+    __m512i pe = _mm512_maskz_mul_epu32(ALL8, a, b);
+    __m512i po = _mm512_maskz_mul_epu32(ALL8, _mm512_maskz_srli_epi64(ALL8, a, 32), _mm512_maskz_srli_epi64(ALL8, b, 32));
+    lo = _mm512_mask_blend_epi32(0xAAAA, pe, _mm512_maskz_slli_epi64(ALL8, po, 32));
+    hi = _mm512_mask_blend_epi32(0xAAAA, _mm512_maskz_srli_epi64(ALL8, pe, 32), po);
+}
+
+__attribute__((target("avx512f")))
+static void philoxAvx512(uint64_t counter, uint64_t key, uint32_t *words, size_t count)
+{
+    const __m512i m0 = _mm512_set1_epi32(PHILOX_M0);
+    const __m512i m1 = _mm512_set1_epi32(PHILOX_M1);
+    size_t ii = 0;
+
+    // Sixteen counters per pass, one in each lane
+    for (; ii + 16 <= count; ii += 16)
+    {
+        uint32_t lo[16], hi[16];
+        for (size_t ll = 0; ll < 16; ++ll)
+        {
+            uint64_t c = counter + ii + ll;
+            lo[ll] = (uint32_t) c;
+            hi[ll] = (uint32_t) (c >> 32);
+        }
+        __m512i x0 = _mm512_loadu_si512(lo);
+        __m512i x1 = _mm512_loadu_si512(hi);
+        __m512i x2 = _mm512_setzero_si512();
+        __m512i x3 = _mm512_setzero_si512();
+        __m512i k0 = _mm512_set1_epi32((uint32_t) key);
+        __m512i k1 = _mm512_set1_epi32((uint32_t) (key >> 32));
+
+        for (int rr = 0; rr < PHILOX_ROUNDS; ++rr)
+        {
+            __m512i hi0, lo0, hi1, lo1;
+            mulhiloAvx512(x0, m0, hi0, lo0);
+            mulhiloAvx512(x2, m1, hi1, lo1);
+            x0 = _mm512_xor_si512(_mm512_xor_si512(hi1, x1), k0);
+            x1 = lo1;
+            x2 = _mm512_xor_si512(_mm512_xor_si512(hi0, x3), k1);
+            x3 = lo0;
+            k0 = _mm512_add_epi32(k0, _mm512_set1_epi32(PHILOX_W0));
+            k1 = _mm512_add_epi32(k1, _mm512_set1_epi32(PHILOX_W1));
+        }
+
+        // Transposing within the 128 bit quarters leaves counters n, n + 4,
+        // n + 8 and n + 12 in register n, so the quarters are gathered in order
+        __m512i t0 = _mm512_maskz_unpacklo_epi32(ALL16, x0, x1);
+        __m512i t1 = _mm512_maskz_unpacklo_epi32(ALL16, x2, x3);
+        __m512i t2 = _mm512_maskz_unpackhi_epi32(ALL16, x0, x1);
+        __m512i t3 = _mm512_maskz_unpackhi_epi32(ALL16, x2, x3);
+        __m512i c0 = _mm512_maskz_unpacklo_epi64(ALL8, t0, t1);
+        __m512i c1 = _mm512_maskz_unpackhi_epi64(ALL8, t0, t1);
+        __m512i c2 = _mm512_maskz_unpacklo_epi64(ALL8, t2, t3);
+        __m512i c3 = _mm512_maskz_unpackhi_epi64(ALL8, t2, t3);
+        __m512i e01 = _mm512_maskz_shuffle_i32x4(ALL16, c0, c1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m512i e23 = _mm512_maskz_shuffle_i32x4(ALL16, c2, c3, _MM_SHUFFLE(2, 0, 2, 0));
+        __m512i o01 = _mm512_maskz_shuffle_i32x4(ALL16, c0, c1, _MM_SHUFFLE(3, 1, 3, 1));
+        __m512i o23 = _mm512_maskz_shuffle_i32x4(ALL16, c2, c3, _MM_SHUFFLE(3, 1, 3, 1));
+        uint32_t *w = words + 4 * ii;
+        _mm512_storeu_si512(w, _mm512_maskz_shuffle_i32x4(ALL16, e01, e23, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm512_storeu_si512(w + 16, _mm512_maskz_shuffle_i32x4(ALL16, o01, o23, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm512_storeu_si512(w + 32, _mm512_maskz_shuffle_i32x4(ALL16, e01, e23, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm512_storeu_si512(w + 48, _mm512_maskz_shuffle_i32x4(ALL16, o01, o23, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+
+    philoxAvx2(counter + ii, key, words + 4 * ii, count - ii);
+}
+
+#undef ALL8
+#undef ALL16
+
+#endif // KERNEL_SELECT_AVX512
+
+
+#ifdef KERNEL_SELECT_NEON
+
+// Complex products of deinterleaved samples, in the order of rotateRowScalar
+static inline void cmulNeon(float32x4_t xr, float32x4_t xi, float32x4_t pr, float32x4_t pi,
+    float32x4_t &re, float32x4_t &im)
+{
+    re = vsubq_f32(vmulq_f32(xr, pr), vmulq_f32(xi, pi));
+    im = vaddq_f32(vmulq_f32(xi, pr), vmulq_f32(xr, pi));
+}
+
+static void rotateNeon(const Complex *in, Complex *out, size_t count,
+    const Complex *phasors, Complex step, bool accumulate)
+{
+    const float *inF = reinterpret_cast<const float *>(in);
+    float *outF = reinterpret_cast<float *>(out);
+    const float *ph = reinterpret_cast<const float *>(phasors);
+    float32x4_t sr = vdupq_n_f32(step.real());
+    float32x4_t si = vdupq_n_f32(step.imag());
+    float32x4x2_t lane0 = vld2q_f32(ph);
+    float32x4x2_t lane1 = vld2q_f32(ph + 8);
+    size_t ii = 0;
+
+    // ROTATE_LANES samples per pass, four in each pair of registers
+    for (; ii + ROTATE_LANES <= count; ii += ROTATE_LANES)
+    {
+        float32x4x2_t x0 = vld2q_f32(inF + 2 * ii);
+        float32x4x2_t x1 = vld2q_f32(inF + 2 * ii + 8);
+        float32x4x2_t y0, y1;
+        cmulNeon(x0.val[0], x0.val[1], lane0.val[0], lane0.val[1], y0.val[0], y0.val[1]);
+        cmulNeon(x1.val[0], x1.val[1], lane1.val[0], lane1.val[1], y1.val[0], y1.val[1]);
+        if (accumulate)
+        {
+            float32x4x2_t o0 = vld2q_f32(outF + 2 * ii);
+            float32x4x2_t o1 = vld2q_f32(outF + 2 * ii + 8);
+            y0.val[0] = vaddq_f32(o0.val[0], y0.val[0]);
+            y0.val[1] = vaddq_f32(o0.val[1], y0.val[1]);
+            y1.val[0] = vaddq_f32(o1.val[0], y1.val[0]);
+            y1.val[1] = vaddq_f32(o1.val[1], y1.val[1]);
+        }
+        vst2q_f32(outF + 2 * ii, y0);
+        vst2q_f32(outF + 2 * ii + 8, y1);
+        cmulNeon(lane0.val[0], lane0.val[1], sr, si, lane0.val[0], lane0.val[1]);
+        cmulNeon(lane1.val[0], lane1.val[1], sr, si, lane1.val[0], lane1.val[1]);
+    }
+
+    float p[2 * ROTATE_LANES];
+    vst2q_f32(p, lane0);
+    vst2q_f32(p + 8, lane1);
+    rotateRowScalar(inF + 2 * ii, outF + 2 * ii, count - ii, p, accumulate);
+}
+
+// Phasors of four phases, in the order of sincosScalar
+static inline void sincosNeon(uint32x4_t ph, float32x4_t &c, float32x4_t &s)
+{
+    const uint32x4_t one = vdupq_n_u32(1);
+    const uint32x4_t two = vdupq_n_u32(2);
+    uint32x4_t q = vshrq_n_u32(vaddq_u32(ph, vdupq_n_u32(0x20000000)), 30);
+    float32x4_t x = vmulq_f32(vcvtq_f32_s32(vreinterpretq_s32_u32(vsubq_u32(ph, vshlq_n_u32(q, 30)))), vdupq_n_f32(PHASE_SCALE));
+    float32x4_t x2 = vmulq_f32(x, x);
+    float32x4_t ps = vaddq_f32(vdupq_n_f32(SIN_C5), vmulq_f32(x2, vdupq_n_f32(SIN_C7)));
+    ps = vaddq_f32(vdupq_n_f32(SIN_C3), vmulq_f32(x2, ps));
+    float32x4_t sx = vaddq_f32(x, vmulq_f32(vmulq_f32(x, x2), ps));
+    float32x4_t pc = vaddq_f32(vdupq_n_f32(COS_C6), vmulq_f32(x2, vdupq_n_f32(COS_C8)));
+    pc = vaddq_f32(vdupq_n_f32(COS_C4), vmulq_f32(x2, pc));
+    pc = vaddq_f32(vdupq_n_f32(-0.5f), vmulq_f32(x2, pc));
+    float32x4_t cx = vaddq_f32(vdupq_n_f32(1.0f), vmulq_f32(x2, pc));
+    uint32x4_t swap = vceqq_u32(vandq_u32(q, one), one);
+    uint32x4_t sq = vreinterpretq_u32_f32(vbslq_f32(swap, cx, sx));
+    uint32x4_t cq = vreinterpretq_u32_f32(vbslq_f32(swap, sx, cx));
+    c = vreinterpretq_f32_u32(veorq_u32(cq, vshlq_n_u32(vandq_u32(vaddq_u32(q, one), two), 30)));
+    s = vreinterpretq_f32_u32(veorq_u32(sq, vshlq_n_u32(vandq_u32(q, two), 30)));
+}
+
+static void sincosNeon(const uint32_t *phases, Complex *out, size_t count)
+{
+    float *o = reinterpret_cast<float *>(out);
+    size_t ii = 0;
+
+    for (; ii + 4 <= count; ii += 4)
+    {
+        float32x4x2_t y;
+        sincosNeon(vld1q_u32(phases + ii), y.val[0], y.val[1]);
+        vst2q_f32(o + 2 * ii, y);
+    }
+
+    sincosScalar(phases + ii, out + ii, count - ii);
+}
+
+// The 32 bit halves of the 64 bit products of four pairs of words
+static inline void mulhiloNeon(uint32x4_t a, uint32x4_t b, uint32x4_t &hi, uint32x4_t &lo)
+{
+    uint64x2_t pl = vmull_u32(vget_low_u32(a), vget_low_u32(b));
+    uint64x2_t ph = vmull_u32(vget_high_u32(a), vget_high_u32(b));
+    lo = vcombine_u32(vmovn_u64(pl), vmovn_u64(ph));
+    hi = vcombine_u32(vshrn_n_u64(pl, 32), vshrn_n_u64(ph, 32));
+}
+
+static void philoxNeon(uint64_t counter, uint64_t key, uint32_t *words, size_t count)
+{
+    const uint32x4_t m0 = vdupq_n_u32(PHILOX_M0);
+    const uint32x4_t m1 = vdupq_n_u32(PHILOX_M1);
+    size_t ii = 0;
+
+    // Four counters per pass, one in each lane
+    for (; ii + 4 <= count; ii += 4)
+    {
+        uint32_t lo[4], hi[4];
+        for (size_t ll = 0; ll < 4; ++ll)
+        {
+            uint64_t c = counter + ii + ll;
+            lo[ll] = (uint32_t) c;
+            hi[ll] = (uint32_t) (c >> 32);
+        }
+        uint32x4x4_t x;
+        x.val[0] = vld1q_u32(lo);
+        x.val[1] = vld1q_u32(hi);
+        x.val[2] = vdupq_n_u32(0);
+        x.val[3] = vdupq_n_u32(0);
+        uint32x4_t k0 = vdupq_n_u32((uint32_t) key);
+        uint32x4_t k1 = vdupq_n_u32((uint32_t) (key >> 32));
+
+        for (int rr = 0; rr < PHILOX_ROUNDS; ++rr)
+        {
+            uint32x4_t hi0, lo0, hi1, lo1;
+            mulhiloNeon(x.val[0], m0, hi0, lo0);
+            mulhiloNeon(x.val[2], m1, hi1, lo1);
+            x.val[0] = veorq_u32(veorq_u32(hi1, x.val[1]), k0);
+            x.val[1] = lo1;
+            x.val[2] = veorq_u32(veorq_u32(hi0, x.val[3]), k1);
+            x.val[3] = lo0;
+            k0 = vaddq_u32(k0, vdupq_n_u32(PHILOX_W0));
+            k1 = vaddq_u32(k1, vdupq_n_u32(PHILOX_W1));
+        }
+
+        // The interleaving store puts each counter's four words together
+        vst4q_u32(words + 4 * ii, x);
+    }
+
+    philoxScalar(counter + ii, key, words + 4 * ii, count - ii);
+}
+
+// The square root is only available on AArch64, so 32 bit ARM uses the portable kernel
+#ifdef __aarch64__
+static void gaussianNeon(const uint32_t *words, Complex *out, size_t count, Real sigma,
+    bool accumulate)
+{
+    float *o = reinterpret_cast<float *>(out);
+    const float32x4_t sig = vdupq_n_f32(sigma);
+    size_t ii = 0;
+
+    for (; ii + 4 <= count; ii += 4)
+    {
+        // The deinterleaving load splits the pairs into magnitude and phase words
+        uint32x4x2_t w = vld2q_u32(words + 2 * ii);
+        float32x4_t u = vmulq_f32(vcvtq_f32_s32(vreinterpretq_s32_u32(vorrq_u32(vshrq_n_u32(w.val[0], 8), vdupq_n_u32(1)))),
+            vdupq_n_f32(UNIFORM_SCALE));
+        uint32x4_t bits = vreinterpretq_u32_f32(u);
+        float32x4_t e = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+        float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x3F800000)));
+        uint32x4_t big = vcgtq_f32(m, vdupq_n_f32(SQRT_2));
+        m = vbslq_f32(big, vmulq_f32(m, vdupq_n_f32(0.5f)), m);
+        e = vbslq_f32(big, vaddq_f32(e, vdupq_n_f32(1.0f)), e);
+        float32x4_t x = vsubq_f32(m, vdupq_n_f32(1.0f));
+        float32x4_t x2 = vmulq_f32(x, x);
+        float32x4_t p = vaddq_f32(vmulq_f32(vdupq_n_f32(LOG_P0), x), vdupq_n_f32(LOG_P1));
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(LOG_P2));
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(LOG_P3));
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(LOG_P4));
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(LOG_P5));
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(LOG_P6));
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(LOG_P7));
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(LOG_P8));
+        float32x4_t y = vmulq_f32(vmulq_f32(p, x), x2);
+        y = vaddq_f32(y, vmulq_f32(vdupq_n_f32(LN2_LO), e));
+        y = vsubq_f32(y, vmulq_f32(vdupq_n_f32(0.5f), x2));
+        float32x4_t logU = vaddq_f32(x, y);
+        logU = vaddq_f32(logU, vmulq_f32(vdupq_n_f32(LN2_HI), e));
+        float32x4_t r = vmulq_f32(sig, vsqrtq_f32(vmulq_f32(vdupq_n_f32(-2.0f), logU)));
+
+        float32x4x2_t z;
+        sincosNeon(w.val[1], z.val[0], z.val[1]);
+        z.val[0] = vmulq_f32(r, z.val[0]);
+        z.val[1] = vmulq_f32(r, z.val[1]);
+        if (accumulate)
+        {
+            float32x4x2_t acc = vld2q_f32(o + 2 * ii);
+            z.val[0] = vaddq_f32(acc.val[0], z.val[0]);
+            z.val[1] = vaddq_f32(acc.val[1], z.val[1]);
+        }
+        vst2q_f32(o + 2 * ii, z);
+    }
+
+    gaussianScalar(words + 2 * ii, out + ii, count - ii, sigma, accumulate);
+}
+#endif
+
+#endif // KERNEL_SELECT_NEON
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Returns the kernels for the given type.  All are NULL if the type is
+//   not supported by this CPU and compiler.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+static kernel_set lookup(KernelSelect::kernel_type type)
+{
+    kernel_set kernels = { NULL, NULL, NULL, NULL };
+
+    if (!KernelSelect::supported(type))
+        return kernels;
+
+    switch (type)
+    {
+    case KernelSelect::scalar:
+        kernels.rotate = rotateScalar;
+        kernels.sincos = sincosScalar;
+        kernels.philox = philoxScalar;
+        kernels.gaussian = gaussianScalar;
+        break;
+#ifdef KERNEL_SELECT_X86
+    case KernelSelect::sse2:
+        kernels.rotate = rotateSse2;
+        kernels.sincos = sincosSse2;
+        kernels.philox = philoxSse2;
+        kernels.gaussian = gaussianSse2;
+        break;
+    case KernelSelect::avx2:
+        kernels.rotate = rotateAvx2;
+        kernels.sincos = sincosAvx2;
+        kernels.philox = philoxAvx2;
+        kernels.gaussian = gaussianAvx2;
+        break;
+#endif
+#ifdef KERNEL_SELECT_AVX512
+    case KernelSelect::avx512:
+        // The oscillator is bound by its lanes, the phasors are a short part of the
+        // modulator and the Box-Muller transform is left to AVX2 as well, but the
+        // random words are all integer multiplies.
+        kernels.rotate = rotateAvx2;
+        kernels.sincos = sincosAvx2;
+        kernels.philox = philoxAvx512;
+        kernels.gaussian = gaussianAvx2;
+        break;
+#endif
+#ifdef KERNEL_SELECT_NEON
+    case KernelSelect::neon:
+        kernels.rotate = rotateNeon;
+        kernels.sincos = sincosNeon;
+        kernels.philox = philoxNeon;
+#ifdef __aarch64__
+        kernels.gaussian = gaussianNeon;
+#else
+        kernels.gaussian = gaussianScalar;
+#endif
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return kernels;
+}
+
+static KernelSelect::kernel_type currentType = KernelSelect::best();
+static kernel_set currentKernels = lookup(currentType);
+
+
+void rotate(const Complex *in, Complex *out, size_t count,
+    const Complex *phasors, Complex step, bool accumulate)
+{
+    if (count == 0)
+        return;
+
+    currentKernels.rotate(in, out, count, phasors, step, accumulate);
+}
+
+void sincos(const uint32_t *phases, Complex *out, size_t count)
+{
+    if (count == 0)
+        return;
+
+    currentKernels.sincos(phases, out, count);
+}
+
+void philox(uint64_t counter, uint64_t key, uint32_t *words, size_t count)
+{
+    if (count == 0)
+        return;
+
+    currentKernels.philox(counter, key, words, count);
+}
+
+void gaussian(const uint32_t *words, Complex *out, size_t count, Real sigma,
+    bool accumulate)
+{
+    if (count == 0)
+        return;
+
+    currentKernels.gaussian(words, out, count, sigma, accumulate);
+}
+
+bool select(KernelSelect::kernel_type type)
+{
+    if (type == KernelSelect::automatic)
+        type = KernelSelect::best();
+
+    kernel_set kernels = lookup(type);
+    if (kernels.rotate == NULL)
+        return false;
+
+    currentType = type;
+    currentKernels = kernels;
+    return true;
+}
+
+KernelSelect::kernel_type selected(void)
+{
+    return currentType;
+}
+
+} // namespace SignalKernel
@@ -28,6 +28,7 @@
 
 #include <cmath>
 #include <numeric>
+#include <algorithm>
 #include "Tuner.h"
 #include <iostream>
 
@@ -38,6 +39,9 @@
 
 using namespace std;
 
+// Samples between restarts of the oscillator from its double precision phase
+#define TUNER_SEGMENT 4096
+
 
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 //
@@ -117,8 +121,14 @@ Tuner::~Tuner()
 
 void Tuner::retune(Real normFc)
 {
-	_dphasor     = Complex(cos(2*M_PI*normFc), sin(-2*M_PI*normFc));
     _dcycles = normFc;
+
+    // Offset of each lane of the oscillator from the first, and the step of every lane
+    for (size_t k = 0; k < SignalKernel::ROTATE_LANES; ++k)
+        _laneOffsets[k] = std::complex<double>(cos(2*M_PI*k*_dcycles), -sin(2*M_PI*k*_dcycles));
+
+    double laneRad = 2*M_PI*SignalKernel::ROTATE_LANES*_dcycles;
+    _laneStep = Complex(cos(laneRad), -sin(laneRad));
 }
 
 
@@ -157,6 +167,87 @@ void Tuner::reset(void)
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 bool Tuner::run(void)
+{
+    run(0, _input.size());
+    advance(_input.size());
+
+#ifdef TUNER_DEBUG
+    std::ofstream tunerFile("tunersinusoid.dat", ios_base::out|ios_base::binary);
+	tunerFile.write((char *)&phasorVec[0], phasorVec.size()*sizeof(phasorVec[0]));
+	tunerFile.close();
+#endif
+
+    return true;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Shifts a sub-range of the input samples without advancing the phase of the
+//   tuner.  The phase at the start of the range is computed from the current
+//   phase so disjoint ranges of the same block may be processed concurrently.
+//   Once the whole block has been processed advance() must be called.
+//
+// Parameters:
+//   first - index of the first sample to shift
+//   count - number of samples to shift
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+bool Tuner::run(size_t first, size_t count)
+{
+    shift(first, count, &_output[first], false);
+    return true;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Shifts a sub-range of the input samples, as run() does, but adds them to
+//   the given buffer rather than writing the tuner's output.  This lets many
+//   signals be tuned and summed in one pass without a buffer for each.
+//
+// Parameters:
+//   first - index of the first sample to shift
+//   count - number of samples to shift
+//   output - where to add the shifted samples, output[0] receiving sample first
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+bool Tuner::accumulate(size_t first, size_t count, Complex *output)
+{
+    shift(first, count, output, true);
+    return true;
+}
+
+
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Multiplies a sub-range of the input by the oscillator.  The oscillator
+//   runs as ROTATE_LANES interleaved phasors, each stepping ROTATE_LANES
+//   samples at a time, so the products are independent and vectorize.
+//
+// Parameters:
+//   first - index of the first sample to shift
+//   count - number of samples to shift
+//   output - where to put the shifted samples, output[0] receiving sample first
+//   accumulate - add to the output rather than overwriting it
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void Tuner::shift(size_t first, size_t count, Complex *output, bool accumulate)
 {
     // bsg - I've made some modifications in here to try to compensate for drift and the magnitude
 	// growing/shrinking due to floating point round of errors and abs(exp^(j*theta)) not being EXACTLY one
@@ -166,43 +257,46 @@ bool Tuner::run(void)
 	// to cope with this - I'm storing all the phase values as double precision floating point values
 	// this is now in fractions of a cycle (fs maps to 1)
 
-	// in this loop - we create a complex floating point exponential _ph and use it with
-	// compelex floating point differential exponental _dphasor
-
-	// after the loop - we modify the double value "_cycles" to take into account the adjustment to the oscilator
-	// thus - within the loop we get the fast floating point math (with small erorrs)
-	// but outside the loop we keep acurate representation of the oscilator phase with double precision values to
-	// avoid the systemic errors
-
-	//current phase in radians
-	double cyclesRad = 2*M_PI*_cycles;
-	Complex phasor(cos(cyclesRad), -sin(cyclesRad));
-    for (Complex *x= &_input[0],
-                 *xend = &_input[_input.size()],
-                 *y    = &_output[0];
-                 x != xend; ++x, ++y)
-    {
-        *y = *x * phasor;
-#ifdef TUNER_DEBUG
-    	phasorVec.push_back(_ph);
-#endif
-    	//phasor is acumulating floating round off errors - but this is (hopefully) not for too many samples in this loop
-    	phasor *= _dphasor;
-    };
+	// The float phasors pick up rounding errors as they are stepped, so every TUNER_SEGMENT samples
+	// they are started afresh from the double precision phase
+	Complex phasors[SignalKernel::ROTATE_LANES];
+	double tmp;
+
+	for (size_t done = 0; done < count; done += TUNER_SEGMENT)
+	{
+		size_t segment = std::min(count - done, (size_t) TUNER_SEGMENT);
+
+		//current phase in radians
+		double cyclesRad = 2*M_PI*modf(_cycles + (first + done)*_dcycles, &tmp);
+		std::complex<double> start(cos(cyclesRad), -sin(cyclesRad));
+
+		for (size_t k = 0; k < SignalKernel::ROTATE_LANES; ++k)
+			phasors[k] = Complex(start * _laneOffsets[k]);
+
+		SignalKernel::rotate(&_input[first + done], output + done, segment, phasors, _laneStep, accumulate);
+	}
+}
+
 
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+//
+// Description:
+//   Advances the phase of the tuner by the given number of samples.
+//
+// Parameters:
+//   count - number of samples processed since the last advance
+//
+// Return Value:
+//   None.
+//
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void Tuner::advance(size_t count)
+{
     // adjust the current phase for the number of samples processed
-    _cycles +=(_input.size()*_dcycles);
+    _cycles +=(count*_dcycles);
     //now get rid of the integer part - we only care about the fractional part of the cycles
     //of _cycles
     double tmp;
     _cycles = modf(_cycles,&tmp);
-
-
-#ifdef TUNER_DEBUG
-    std::ofstream tunerFile("tunersinusoid.dat", ios_base::out|ios_base::binary);
-	tunerFile.write((char *)&phasorVec[0], phasorVec.size()*sizeof(phasorVec[0]));
-	tunerFile.close();
-#endif
-
-    return true;
 }
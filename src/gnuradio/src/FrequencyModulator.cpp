@@ -4,31 +4,43 @@
  *  Created on: Nov 21, 2014
  */
 
+#include <algorithm>
+#include <math.h>
 #include "FrequencyModulator.h"
+#include "SignalKernel.h"
+
+// Samples modulated per pass, sized to keep the phases on the stack
+#define MODULATOR_CHUNK 1024
 
 FrequencyModulator::FrequencyModulator(float sensitivity) {
-	d_sensitivity = sensitivity;
-	d_phase = 0.0;
+	// The sensitivity is given in radians per unit of input, the accumulator
+	// counts 2^32 per cycle.
+	d_sensitivity = (float) (sensitivity * 4294967296.0 / (2.0 * M_PI));
+	d_phase = 0;
 }
 
 FrequencyModulator::~FrequencyModulator() {
 }
 
-// Algorithm taken from the gnuradio block frequency_modulator
+// Algorithm taken from the gnuradio block frequency_modulator, with the phase
+// kept in a fixed point accumulator that wraps on its own instead of a float
+// that is folded and converted on every sample.
 void FrequencyModulator::modulate(std::valarray<float> &input, std::valarray< std::complex<float> > &output) {
-     for(int i = 0; i < input.size(); i++) {
-       d_phase = d_phase + d_sensitivity * input[i];
-
-       while(d_phase > (float)(M_PI))
-         d_phase -= (float)(2.0 * M_PI);
-       while(d_phase < (float)(-M_PI))
-         d_phase += (float)(2.0 * M_PI);
-
-       float oi, oq;
-
-       int32_t angle = float_to_fixed (d_phase);
-       fixed_sincos(angle, &oq, &oi);
-       output[i] = std::complex<float>(oi, oq);
-     }
+	uint32_t phases[MODULATOR_CHUNK];
+
+	for (size_t first = 0; first < input.size(); first += MODULATOR_CHUNK) {
+		size_t count = std::min((size_t) MODULATOR_CHUNK, input.size() - first);
+		const float *in = &input[first];
+		uint32_t phase = d_phase;
+
+		for (size_t i = 0; i < count; i++) {
+			// Through 64 bits so that steps of more than half a cycle wrap
+			// as the float phase did
+			phase += (uint32_t) (int64_t) (d_sensitivity * in[i]);
+			phases[i] = phase;
+		}
+
+		d_phase = phase;
+		SignalKernel::sincos(phases, &output[first], count);
+	}
 }
-
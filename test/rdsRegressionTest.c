@@ -0,0 +1,196 @@
+/*
+ * This file is protected by Copyright. Please refer to the COPYRIGHT file
+ * distributed with this source distribution.
+ *
+ * This file is part of REDHAWK librfsimulators.
+ *
+ * REDHAWK librfsimulators is free software: you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * REDHAWK librfsimulators is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses/.
+ */
+/*
+ ============================================================================
+ Name        : rdsRegressionTest.c
+ Description : Checks that get_rds_samples, which copies each bit period from
+               a table of segments, produces exactly the samples of the
+               original overlap-add routine kept below.  The two are driven
+               side by side with random chunk sizes while the RDS content
+               is changed at random, so the group sequence is random too.
+
+               Usage: rdsRegressionTest [runs] [seconds per run]
+ ============================================================================
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rds.h"
+
+#define SAMPLE_BUFFER_SIZE (SAMPLES_PER_BIT + FILTER_SIZE)
+#define MAX_CHUNK 5000
+
+extern void get_rds_group(int *buffer, struct rds_content_struct* rds_params, struct rds_signal_info* rds_sig_info);
+
+/* The state of the original routine.  The group generator keeps its own state in
+   group_info, which the original kept in the same struct.
+ */
+struct old_rds_signal {
+    struct rds_signal_info group_info;
+    float sample_buffer[SAMPLE_BUFFER_SIZE];
+    int inverting;
+    int phase;
+    int in_sample_index;
+    int out_sample_index;
+};
+
+static void old_init_rds_signal(struct old_rds_signal *old) {
+    init_rds_signal(&old->group_info);
+    memset(old->sample_buffer, 0, sizeof(old->sample_buffer));
+    old->inverting = 0;
+    old->phase = 0;
+    old->in_sample_index = 0;
+    old->out_sample_index = SAMPLE_BUFFER_SIZE-1;
+}
+
+/* The original get_rds_samples.  It overlap-adds the biphase waveform of each bit into
+   a ring buffer, then drains the buffer a sample at a time modulating it with the
+   57 kHz carrier.
+ */
+static void old_get_rds_samples(float *buffer, int count, struct rds_content_struct* rds_content, struct old_rds_signal *old) {
+    struct rds_signal_info *rds_signal = &old->group_info;
+    int i;
+    for(i=0; i<count; i++) {
+        if(rds_signal->sample_count >= SAMPLES_PER_BIT) {
+            if(rds_signal->bit_pos >= BITS_PER_GROUP) {
+                get_rds_group(rds_signal->bit_buffer, rds_content, rds_signal);
+                rds_signal->bit_pos = 0;
+            }
+
+            // do differential encoding
+            rds_signal->cur_bit = rds_signal->bit_buffer[rds_signal->bit_pos];
+            rds_signal->prev_output = rds_signal->cur_output;
+            rds_signal->cur_output = rds_signal->prev_output ^ rds_signal->cur_bit;
+
+            old->inverting = (rds_signal->cur_output == 1);
+
+            float *src = waveform_biphase;
+            int idx = old->in_sample_index;
+            int j;
+            for(j=0; j<FILTER_SIZE; j++) {
+                float val = (*src++);
+                if(old->inverting) val = -val;
+                old->sample_buffer[idx++] += val;
+                if(idx >= SAMPLE_BUFFER_SIZE) idx = 0;
+            }
+
+            old->in_sample_index += SAMPLES_PER_BIT;
+            if(old->in_sample_index >= SAMPLE_BUFFER_SIZE) old->in_sample_index -= SAMPLE_BUFFER_SIZE;
+
+            rds_signal->bit_pos++;
+            rds_signal->sample_count = 0;
+        }
+
+        float sample = old->sample_buffer[old->out_sample_index];
+        old->sample_buffer[old->out_sample_index] = 0;
+        old->out_sample_index++;
+        if(old->out_sample_index >= SAMPLE_BUFFER_SIZE) old->out_sample_index = 0;
+
+        // modulate at 57 kHz
+        switch(old->phase) {
+            case 0:
+            case 2: sample = 0; break;
+            case 1: break;
+            case 3: sample = -sample; break;
+        }
+        old->phase++;
+        if(old->phase >= 4) old->phase = 0;
+
+        *buffer++ = sample;
+        rds_signal->sample_count++;
+        rds_signal->sample_counter++;
+    }
+}
+
+static void random_text(char *text, int length) {
+    int i;
+    for(i=0; i<length; i++) {
+        text[i] = 32 + rand() % 95;
+    }
+}
+
+static void random_content(struct rds_content_struct *content) {
+    content->pi = rand() & 0xFFFF;
+    content->pty = rand() % 32;
+    content->ta = rand() % 2;
+    random_text(content->ps, PS_LENGTH);
+    random_text(content->rt, RT_LENGTH);
+}
+
+/* Runs both routines over the given number of samples, returning 0 if they match
+ */
+static int run(int seed, unsigned long long num_samples) {
+    static struct rds_signal_info signal;
+    static struct old_rds_signal old;
+    static float expected[MAX_CHUNK], actual[MAX_CHUNK];
+    struct rds_content_struct content;
+    unsigned long long done = 0;
+
+    srand(seed);
+    random_content(&content);
+
+    old_init_rds_signal(&old);
+    init_rds_signal(&signal);
+
+    // Count the clock time groups in samples from a random start so that they are the
+    // same for both and several of them fall within a run
+    signal.use_sim_clock = old.group_info.use_sim_clock = 1;
+    signal.sim_clock_start = old.group_info.sim_clock_start = 1400000000 + rand();
+
+    while(done < num_samples) {
+        int count;
+        switch(rand() % 4) {
+            case 0: count = 1 + rand() % 8; break;
+            case 1: count = SAMPLES_PER_BIT - 2 + rand() % 5; break;
+            default: count = 1 + rand() % MAX_CHUNK; break;
+        }
+        if(done + count > num_samples) count = (int) (num_samples - done);
+
+        old_get_rds_samples(expected, count, &content, &old);
+        get_rds_samples(actual, count, &content, &signal);
+
+        if(memcmp(expected, actual, count * sizeof(float)) != 0) {
+            int i;
+            for(i=0; expected[i] == actual[i]; i++);
+            printf("Run %d: sample %llu is %.9g, expected %.9g\n", seed, done + i, actual[i], expected[i]);
+            return 1;
+        }
+        done += count;
+
+        if(rand() % 50 == 0) random_content(&content);
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    int runs = (argc > 1) ? atoi(argv[1]) : 10;
+    double seconds = (argc > 2) ? atof(argv[2]) : 70;
+    int failed = 0;
+    int seed;
+
+    for(seed=1; seed<=runs; seed++) {
+        failed += run(seed, (unsigned long long) (seconds * RDS_SAMPLE_RATE));
+    }
+
+    printf("%d of %d runs of %.0f seconds matched the overlap-add routine\n", runs - failed, runs, seconds);
+    return failed ? 1 : 0;
+}